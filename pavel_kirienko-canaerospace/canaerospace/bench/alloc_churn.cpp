@@ -0,0 +1,69 @@
+/*
+ * Subscription churn with the system allocator versus the library pool
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include <canaerospace/pool.h>
+#include "bench.hpp"
+
+namespace
+{
+    const int CYCLES = 200000;
+    const int PARAMS_PER_CYCLE = 8;
+
+    void cbParam(CanasInstance*, CanasParamCallbackArgs*) { }
+
+    void cbRequest(CanasInstance*, CanasServiceRequestCallbackArgs*) { }
+
+    /// Subscribes to a few params, registers a service, and tears everything down again
+    void churn(CanasInstance* pi, const char* name)
+    {
+        const uint64_t started = nanosNow();
+        for (int i = 0; i < CYCLES; i++)
+        {
+            for (int k = 0; k < PARAMS_PER_CYCLE; k++)
+            {
+                if (canasParamSubscribe(pi, 300 + k, 1 + k % 4, cbParam, NULL) != 0 ||
+                    canasParamAdvertise(pi, 400 + k, false) != 0)
+                    std::exit(1);
+            }
+            if (canasServiceRegister(pi, 100, NULL, cbRequest, NULL, NULL) != 0)
+                std::exit(1);
+            for (int k = 0; k < PARAMS_PER_CYCLE; k++)
+            {
+                canasParamUnsubscribe(pi, 300 + k);
+                canasParamUnadvertise(pi, 400 + k);
+            }
+            canasServiceUnregister(pi, 100);
+        }
+        report(name, nanosNow() - started, uint64_t(CYCLES) * (PARAMS_PER_CYCLE * 2 + 1) * 2);
+    }
+}
+
+int main()
+{
+    CanasConfig cfg = makeBenchConfig();
+    CanasInstance* pi = makeBenchInstance(cfg);
+    churn(pi, "alloc+free, malloc()");
+    std::free(pi);
+
+    static uint8_t buf[8192];
+    CanasPool pool;
+    canasPoolInit(&pool, buf, sizeof(buf));
+    cfg.fn_malloc = canasPoolMallocFn;
+    cfg.fn_free = canasPoolFreeFn;
+    cfg.pmem_state = &pool;
+    pi = makeBenchInstance(cfg);
+    churn(pi, "alloc+free, pool");
+
+    std::printf("pool: %u of %u bytes used, peak in use %u, failures %u\n",
+                unsigned(pool.buf_used), unsigned(pool.buf_size), unsigned(pool.bytes_peak), unsigned(pool.failures));
+    for (int i = 0; i < CANAS_POOL_CLASS_COUNT; i++)
+    {
+        if (pool.classes[i].blocks_total > 0)
+            std::printf("  class %2i: peak %u blocks, %u total\n", i, unsigned(pool.classes[i].blocks_peak),
+                        unsigned(pool.classes[i].blocks_total));
+    }
+    std::free(pi);
+    return pool.failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,83 @@
+/*
+ * Shared stuff for benchmarks
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#ifndef BENCH_HPP_
+#define BENCH_HPP_
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <time.h>
+#include <canaerospace/canaerospace.h>
+
+#define BENCH_IFACE_COUNT 1
+#define BENCH_NODE_ID     42
+
+namespace
+{
+    uint64_t bench_timestamp = 1;
+
+    inline uint64_t nanosNow()
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return uint64_t(ts.tv_sec) * 1000000000ull + ts.tv_nsec;
+    }
+
+    void* benchMalloc(CanasInstance*, int size) { return std::malloc(size); }
+
+    void benchFree(CanasInstance*, void* ptr) { std::free(ptr); }
+
+    uint64_t benchTimestamp(CanasInstance*) { return bench_timestamp; }
+
+    int benchSend(CanasInstance*, int, const CanasCanFrame*) { return 1; }
+
+    inline CanasConfig makeBenchConfig()
+    {
+        CanasConfig cfg = canasMakeConfig();
+        cfg.fn_send      = benchSend;
+        cfg.fn_timestamp = benchTimestamp;
+        cfg.fn_malloc    = benchMalloc;
+        cfg.fn_free      = benchFree;
+        cfg.iface_count  = BENCH_IFACE_COUNT;
+        cfg.node_id      = BENCH_NODE_ID;
+        return cfg;
+    }
+
+    /// The instance is huge, so it's better to keep it off the stack
+    inline CanasInstance* makeBenchInstance(const CanasConfig& cfg)
+    {
+        CanasInstance* pi = static_cast<CanasInstance*>(std::malloc(sizeof(CanasInstance)));
+        if (pi == NULL || canasInit(pi, &cfg, NULL) != 0)
+        {
+            std::fprintf(stderr, "Failed to initialize the instance\n");
+            std::exit(1);
+        }
+        return pi;
+    }
+
+    inline CanasCanFrame makeBenchFrame(uint16_t msg_id, uint8_t msg_code, float value)
+    {
+        CanasCanFrame frm;
+        std::memset(&frm, 0, sizeof(frm));
+        frm.id = msg_id;
+        frm.data[0] = BENCH_NODE_ID + 1;
+        frm.data[1] = CANAS_DATATYPE_FLOAT;
+        frm.data[3] = msg_code;
+        uint32_t raw = 0;
+        std::memcpy(&raw, &value, 4);
+        for (int i = 0; i < 4; i++)
+            frm.data[4 + i] = uint8_t(raw >> (24 - i * 8));
+        frm.dlc = 8;
+        return frm;
+    }
+
+    inline void report(const char* name, uint64_t elapsed_ns, uint64_t iterations)
+    {
+        std::printf("%-48s %10.1f ns/op\n", name, double(elapsed_ns) / double(iterations));
+    }
+}
+
+#endif
@@ -0,0 +1,58 @@
+/*
+ * Per-call cost of payload conversion for every standard data type
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include "bench.hpp"
+#include "../src/marshal.h"
+
+namespace
+{
+    const int CALLS_PER_RUN = 10000000;
+
+    volatile int sink = 0;
+
+    void run(uint8_t type)
+    {
+        CanasMessageData host;
+        std::memset(&host, 0, sizeof(host));
+        host.type = type;
+        host.container.ULONG = 0xdeadbeef;
+
+        uint8_t wire[4];
+        const int len = canasHostToNetwork(wire, &host);
+        if (len < 0)
+            std::exit(1);
+
+        int acc = 0;
+        const uint64_t h2n_started = nanosNow();
+        for (int i = 0; i < CALLS_PER_RUN; i++)
+        {
+            host.container.UCHAR = uint8_t(i);
+            acc += canasHostToNetwork(wire, &host) + wire[0];
+        }
+        const uint64_t h2n_elapsed = nanosNow() - h2n_started;
+
+        const uint64_t n2h_started = nanosNow();
+        for (int i = 0; i < CALLS_PER_RUN; i++)
+        {
+            wire[0] = uint8_t(i);
+            acc += canasNetworkToHost(&host, wire, len, type) + host.container.UCHAR;
+        }
+        const uint64_t n2h_elapsed = nanosNow() - n2h_started;
+        sink = acc;
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "canasHostToNetwork(), type %2i", int(type));
+        report(name, h2n_elapsed, CALLS_PER_RUN);
+        std::snprintf(name, sizeof(name), "canasNetworkToHost(), type %2i", int(type));
+        report(name, n2h_elapsed, CALLS_PER_RUN);
+    }
+}
+
+int main()
+{
+    for (int type = CANAS_DATATYPE_NODATA; type < CANAS_DATATYPE_RESVD_BEGIN_; type++)
+        run(uint8_t(type));
+    return 0;
+}
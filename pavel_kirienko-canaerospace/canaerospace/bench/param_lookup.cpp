@@ -0,0 +1,102 @@
+/*
+ * Per-frame cost of parameter reception versus number of subscriptions
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include "bench.hpp"
+
+namespace
+{
+    const int FRAMES_PER_RUN = 1000000;
+
+    int callback_count = 0;
+
+    void cbParam(CanasInstance*, CanasParamCallbackArgs*) { callback_count++; }
+
+    void cbParamRef(CanasInstance*, const CanasParamCallbackRefArgs*) { callback_count++; }
+
+    void run(int num_subs, bool zero_copy = false)
+    {
+        CanasConfig cfg = makeBenchConfig();
+        CanasInstance* pi = makeBenchInstance(cfg);
+
+        for (int i = 0; i < num_subs; i++)
+        {
+            const uint16_t msg_id = CANAS_MSGTYPE_NORMAL_OPERATION_MIN + i;
+            const int res = zero_copy ? canasParamSubscribeRef(pi, msg_id, 1, cbParamRef, NULL)
+                                      : canasParamSubscribe(pi, msg_id, 1, cbParam, NULL);
+            if (res != 0)
+                std::exit(1);
+        }
+
+        // Last subscription is the worst case for the linear search, so it goes first
+        CanasCanFrame frames[256];
+        for (int i = 0; i < 256; i++)
+            frames[i] = makeBenchFrame(CANAS_MSGTYPE_NORMAL_OPERATION_MIN + (num_subs - 1 - i % num_subs), 0, 1.0f);
+
+        callback_count = 0;
+        const uint64_t started = nanosNow();
+        for (int i = 0; i < FRAMES_PER_RUN; i++)
+        {
+            CanasCanFrame* pframe = frames + (i & 0xFF);
+            pframe->data[3] = uint8_t(i / num_subs);    // Message code must advance, otherwise it's a repetition
+            canasUpdate(pi, 0, pframe);
+        }
+        const uint64_t elapsed = nanosNow() - started;
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "canasUpdate(), %4i subscriptions%s", num_subs,
+                      zero_copy ? ", zero-copy" : "");
+        report(name, elapsed, FRAMES_PER_RUN);
+
+        CanasParamCallbackArgs args;
+        const uint64_t read_started = nanosNow();
+        for (int i = 0; i < FRAMES_PER_RUN; i++)
+            canasParamRead(pi, CANAS_MSGTYPE_NORMAL_OPERATION_MIN + (i % num_subs), 0, &args);
+        std::snprintf(name, sizeof(name), "canasParamRead(), %4i subscriptions", num_subs);
+        report(name, nanosNow() - read_started, FRAMES_PER_RUN);
+
+        for (int i = 0; i < num_subs; i++)
+            canasParamUnsubscribe(pi, CANAS_MSGTYPE_NORMAL_OPERATION_MIN + i);
+        std::free(pi);
+    }
+
+    /// Busy bus where only every tenth parameter is interesting
+    void runForeign()
+    {
+        CanasConfig cfg = makeBenchConfig();
+        CanasInstance* pi = makeBenchInstance(cfg);
+
+        CanasCanFrame frames[250];
+        for (int i = 0; i < 250; i++)
+        {
+            const uint16_t msg_id = CANAS_MSGTYPE_NORMAL_OPERATION_MIN + i;
+            if (i % 10 == 0 && canasParamSubscribe(pi, msg_id, 1, cbParam, NULL) != 0)
+                std::exit(1);
+            frames[i] = makeBenchFrame(msg_id, 0, 1.0f);
+        }
+
+        const uint64_t started = nanosNow();
+        for (int i = 0; i < FRAMES_PER_RUN; i++)
+        {
+            CanasCanFrame* pframe = frames + (i % 250);
+            pframe->data[3] = uint8_t(i / 250);
+            canasUpdate(pi, 0, pframe);
+        }
+        report("canasUpdate(), 10% of traffic subscribed", nanosNow() - started, FRAMES_PER_RUN);
+
+        for (int i = 0; i < 250; i += 10)
+            canasParamUnsubscribe(pi, CANAS_MSGTYPE_NORMAL_OPERATION_MIN + i);
+        std::free(pi);
+    }
+}
+
+int main()
+{
+    const int sub_counts[] = { 1, 10, 100, 500, 1000, 1500 };
+    for (unsigned i = 0; i < sizeof(sub_counts) / sizeof(sub_counts[0]); i++)
+        run(sub_counts[i]);
+    run(100, true);
+    runForeign();
+    return 0;
+}
@@ -0,0 +1,60 @@
+/*
+ * Per-message cost of parameter publication versus number of advertisements
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include "bench.hpp"
+
+namespace
+{
+    const int MESSAGES_PER_RUN = 1000000;
+
+    void run(int num_advs)
+    {
+        CanasConfig cfg = makeBenchConfig();
+        CanasInstance* pi = makeBenchInstance(cfg);
+
+        for (int i = 0; i < num_advs; i++)
+        {
+            if (canasParamAdvertise(pi, CANAS_MSGTYPE_NORMAL_OPERATION_MIN + i, false) != 0)
+                std::exit(1);
+        }
+
+        CanasMessageData data;
+        std::memset(&data, 0, sizeof(data));
+        data.type = CANAS_DATATYPE_FLOAT;
+        data.container.FLOAT = 1.0f;
+
+        const uint64_t started = nanosNow();
+        for (int i = 0; i < MESSAGES_PER_RUN; i++)
+            canasParamPublish(pi, CANAS_MSGTYPE_NORMAL_OPERATION_MIN + (num_advs - 1 - i % num_advs), &data, 0);
+        const uint64_t elapsed = nanosNow() - started;
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "canasParamPublish(), %4i advertisements", num_advs);
+        report(name, elapsed, MESSAGES_PER_RUN);
+
+        CanasParamHandle handle = NULL;
+        canasParamUnadvertise(pi, CANAS_MSGTYPE_NORMAL_OPERATION_MIN);
+        if (canasParamAdvertiseHandle(pi, CANAS_MSGTYPE_NORMAL_OPERATION_MIN, false, &handle) != 0)
+            std::exit(1);
+
+        const uint64_t handle_started = nanosNow();
+        for (int i = 0; i < MESSAGES_PER_RUN; i++)
+            canasParamPublishHandle(pi, handle, &data, 0);
+        std::snprintf(name, sizeof(name), "canasParamPublishHandle(), %4i advertisements", num_advs);
+        report(name, nanosNow() - handle_started, MESSAGES_PER_RUN);
+
+        for (int i = 0; i < num_advs; i++)
+            canasParamUnadvertise(pi, CANAS_MSGTYPE_NORMAL_OPERATION_MIN + i);
+        std::free(pi);
+    }
+}
+
+int main()
+{
+    const int adv_counts[] = { 1, 10, 100, 400, 1500 };
+    for (unsigned i = 0; i < sizeof(adv_counts) / sizeof(adv_counts[0]); i++)
+        run(adv_counts[i]);
+    return 0;
+}
@@ -0,0 +1,108 @@
+/*
+ * Cost of parameter cache reads from other threads while the parameters are being updated
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "bench.hpp"
+
+namespace
+{
+    const int UPDATES_PER_RUN = 2000000;
+    const int NUM_PARAMS = 8;
+
+    /**
+     * One thread feeds the frames into the instance, the others keep reading the same parameters.
+     * With use_mutex set, both sides take a mutex, which is the only option without CANAEROSPACE_SEQLOCK.
+     */
+    void run(int num_readers, bool use_mutex)
+    {
+        CanasConfig cfg = makeBenchConfig();
+        CanasInstance* pi = makeBenchInstance(cfg);
+
+        CanasCanFrame frames[NUM_PARAMS];
+        for (int i = 0; i < NUM_PARAMS; i++)
+        {
+            const uint16_t msg_id = CANAS_MSGTYPE_NORMAL_OPERATION_MIN + i;
+            if (canasParamSubscribe(pi, msg_id, 1, NULL, NULL) != 0)
+                std::exit(1);
+            frames[i] = makeBenchFrame(msg_id, 0, 1.0f);
+        }
+
+        std::mutex mutex;
+        std::atomic<bool> done(false);
+        std::atomic<uint64_t> num_reads(0);
+
+        std::vector<std::thread> readers;
+        for (int r = 0; r < num_readers; r++)
+        {
+            readers.push_back(std::thread([&, r]()
+            {
+                CanasParamCallbackArgs args;
+                uint64_t reads = 0;
+                while (!done.load(std::memory_order_relaxed))
+                {
+                    const uint16_t msg_id = CANAS_MSGTYPE_NORMAL_OPERATION_MIN + (reads + r) % NUM_PARAMS;
+                    if (use_mutex)
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        canasParamRead(pi, msg_id, 0, &args);
+                    }
+                    else
+                    {
+                        canasParamRead(pi, msg_id, 0, &args);
+                    }
+                    reads++;
+                }
+                num_reads += reads;
+            }));
+        }
+
+        const uint64_t started = nanosNow();
+        for (int i = 0; i < UPDATES_PER_RUN; i++)
+        {
+            CanasCanFrame* pframe = frames + (i % NUM_PARAMS);
+            pframe->data[3] = uint8_t(i / NUM_PARAMS);  // Message code must advance, otherwise it's a repetition
+            if (use_mutex)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                canasUpdate(pi, 0, pframe);
+            }
+            else
+            {
+                canasUpdate(pi, 0, pframe);
+            }
+        }
+        const uint64_t elapsed = nanosNow() - started;
+        done = true;
+        for (size_t i = 0; i < readers.size(); i++)
+            readers[i].join();
+
+        char name[64];
+        const char* mode = use_mutex ? "mutex" : "seqlock";
+        std::snprintf(name, sizeof(name), "canasUpdate(), %i readers, %s", num_readers, mode);
+        report(name, elapsed, UPDATES_PER_RUN);
+        std::snprintf(name, sizeof(name), "canasParamRead(), %i readers, %s", num_readers, mode);
+        report(name, elapsed * num_readers, num_reads);     // Per thread
+
+        for (int i = 0; i < NUM_PARAMS; i++)
+            canasParamUnsubscribe(pi, CANAS_MSGTYPE_NORMAL_OPERATION_MIN + i);
+        std::free(pi);
+    }
+}
+
+int main()
+{
+    const int reader_counts[] = { 1, 3 };
+    for (int i = 0; i < 2; i++)
+    {
+        run(reader_counts[i], true);
+#if CANAEROSPACE_SEQLOCK
+        run(reader_counts[i], false);
+#endif
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+/*
+ * Per-cycle cost of reading a set of parameters: one by one versus a snapshot
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include "bench.hpp"
+
+namespace
+{
+    const int CYCLES_PER_RUN = 200000;
+    const int MAX_PARAMS = 64;
+
+    float sink = 0;
+
+    void run(int num_params)
+    {
+        CanasConfig cfg = makeBenchConfig();
+        CanasInstance* pi = makeBenchInstance(cfg);
+
+        CanasParamSnapshotItem items[MAX_PARAMS];
+        for (int i = 0; i < num_params; i++)
+        {
+            // Scattered IDs, like in a real control loop
+            items[i].message_id = CANAS_MSGTYPE_NORMAL_OPERATION_MIN + (i * 37) % 1000;
+            items[i].redund_chan = 0;
+            if (canasParamSubscribe(pi, items[i].message_id, 1, NULL, NULL) != 0)
+                std::exit(1);
+            const CanasCanFrame frm = makeBenchFrame(items[i].message_id, 0, float(i));
+            canasUpdate(pi, 0, &frm);
+        }
+
+        uint64_t started = nanosNow();
+        for (int c = 0; c < CYCLES_PER_RUN; c++)
+        {
+            for (int i = 0; i < num_params; i++)
+            {
+                CanasParamCallbackArgs args;
+                canasParamRead(pi, items[i].message_id, items[i].redund_chan, &args);
+                sink += args.message.data.container.FLOAT;
+            }
+        }
+        char name[64];
+        std::snprintf(name, sizeof(name), "canasParamRead(), %2i params, per param", num_params);
+        report(name, nanosNow() - started, uint64_t(CYCLES_PER_RUN) * num_params);
+
+        const CanasParamCacheEntry* entries[MAX_PARAMS];
+        CanasParamSnapshot snap;
+        if (canasParamSnapshotInit(pi, &snap, items, num_params, entries) != 0)
+            std::exit(1);
+
+        CanasMessageData values[MAX_PARAMS];
+        uint64_t timestamps[MAX_PARAMS];
+        uint8_t fresh[MAX_PARAMS];
+        CanasParamSnapshotData data;
+        std::memset(&data, 0, sizeof(data));
+        data.pvalues = values;
+        data.ptimestamps_usec = timestamps;
+        data.pfresh = fresh;
+
+        started = nanosNow();
+        for (int c = 0; c < CYCLES_PER_RUN; c++)
+        {
+            canasParamSnapshotTake(&snap, bench_timestamp, 0, &data);
+            for (int i = 0; i < num_params; i++)
+                sink += values[i].container.FLOAT;
+        }
+        std::snprintf(name, sizeof(name), "canasParamSnapshotTake(), %2i params, per param", num_params);
+        report(name, nanosNow() - started, uint64_t(CYCLES_PER_RUN) * num_params);
+
+        std::free(pi);
+    }
+}
+
+int main()
+{
+    run(8);
+    run(32);
+    run(64);
+    return sink == 12345.0f;        // Keep the reads alive
+}
@@ -0,0 +1,45 @@
+/*
+ * Cost of the periodic update versus number of pending service requests
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include "bench.hpp"
+#include <canaerospace/services/std_identification.h>
+
+namespace
+{
+    const int UPDATES_PER_RUN = 1000000;
+
+    void cbIdsResponse(CanasInstance*, uint8_t, CanasSrvIdsPayload*) { }
+
+    void run(bool broadcast)
+    {
+        CanasConfig cfg = makeBenchConfig();
+        cfg.service_request_timeout_usec = 0xFFFFFFFF;    // Requests must stay pending during the whole run
+        CanasInstance* pi = makeBenchInstance(cfg);
+
+        CanasSrvIdsPayload self;
+        std::memset(&self, 0, sizeof(self));
+        if (canasSrvIdsInit(pi, &self, CANAS_MAX_NODES - 1) != 0)
+            std::exit(1);
+        if (broadcast && canasSrvIdsRequest(pi, CANAS_BROADCAST_NODE_ID, cbIdsResponse) != 0)
+            std::exit(1);
+
+        const uint64_t started = nanosNow();
+        for (int i = 0; i < UPDATES_PER_RUN; i++)
+        {
+            bench_timestamp += cfg.service_poll_interval_usec;   // Every update polls the services
+            canasUpdate(pi, 0, NULL);
+        }
+        report(broadcast ? "canasUpdate(), 254 pending IDS requests" : "canasUpdate(), no pending IDS requests",
+               nanosNow() - started, UPDATES_PER_RUN);
+        std::free(pi);
+    }
+}
+
+int main()
+{
+    run(false);
+    run(true);
+    return 0;
+}
@@ -0,0 +1,62 @@
+/*
+ * Per-frame cost of service reception with repetition detection over redundant interfaces
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include "bench.hpp"
+
+namespace
+{
+    const int FRAMES_PER_RUN = 1000000;
+    const int IFACE_COUNT = 3;
+
+    int callback_count = 0;
+
+    void cbRequest(CanasInstance*, CanasServiceRequestCallbackArgs*) { callback_count++; }
+
+    void run(uint8_t hist_len)
+    {
+        CanasConfig cfg = makeBenchConfig();
+        cfg.iface_count = IFACE_COUNT;
+        cfg.service_frame_hist_len = hist_len;
+        CanasInstance* pi = makeBenchInstance(cfg);
+
+        const uint8_t service_code = 2;
+        if (canasServiceRegister(pi, service_code, NULL, cbRequest, NULL, NULL) != 0)
+            std::exit(1);
+
+        // Data chunks of a download session addressed to this node, each arriving from all interfaces
+        CanasCanFrame frm = makeBenchFrame(CANAS_MSGTYPE_NODE_SERVICE_HIGH_MIN, 0, 1.0f);
+        frm.data[0] = BENCH_NODE_ID;
+        frm.data[2] = service_code;
+
+        callback_count = 0;
+        const uint64_t started = nanosNow();
+        for (int i = 0; i < FRAMES_PER_RUN; i++)
+        {
+            frm.data[3] = uint8_t(i / IFACE_COUNT);
+            frm.data[4] = uint8_t(i / IFACE_COUNT / 256);
+            bench_timestamp += 100;
+            canasUpdate(pi, i % IFACE_COUNT, &frm);
+        }
+        const uint64_t elapsed = nanosNow() - started;
+        if (callback_count != FRAMES_PER_RUN / IFACE_COUNT + 1)
+        {
+            std::fprintf(stderr, "Repetition detection failed: %i callbacks\n", callback_count);
+            std::exit(1);
+        }
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "canasUpdate(), service, history of %3i", int(hist_len));
+        report(name, elapsed, FRAMES_PER_RUN);
+        std::free(pi);
+    }
+}
+
+int main()
+{
+    const uint8_t hist_lens[] = { 8, 32, 128, 255 };
+    for (unsigned i = 0; i < sizeof(hist_lens); i++)
+        run(hist_lens[i]);
+    return 0;
+}
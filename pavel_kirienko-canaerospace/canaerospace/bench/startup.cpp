@@ -0,0 +1,72 @@
+/*
+ * Cost of bringing up a node with many parameters, with and without the capacity hints
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include "bench.hpp"
+
+namespace
+{
+    const int RUNS = 2000;
+    const int NUM_PARAMS = 300;
+    const uint16_t FIRST_MSG_ID = 300;
+
+    int malloc_count = 0;
+
+    void* countingMalloc(CanasInstance* pi, int size)
+    {
+        malloc_count++;
+        return benchMalloc(pi, size);
+    }
+
+    void cbParam(CanasInstance*, CanasParamCallbackArgs*) { }
+
+    void run(bool preallocate)
+    {
+        CanasConfig cfg = makeBenchConfig();
+        cfg.fn_malloc = countingMalloc;
+        if (preallocate)
+        {
+            cfg.max_param_subscriptions = NUM_PARAMS;
+            cfg.max_redund_channels = 2;
+            cfg.max_param_advertisements = NUM_PARAMS;
+        }
+        CanasInstance* pi = static_cast<CanasInstance*>(std::malloc(sizeof(CanasInstance)));
+
+        uint64_t elapsed = 0;
+        for (int r = 0; r < RUNS; r++)
+        {
+            malloc_count = 0;
+            const uint64_t started = nanosNow();
+            if (canasInit(pi, &cfg, NULL) != 0)
+                std::exit(1);
+            for (int i = 0; i < NUM_PARAMS; i++)
+            {
+                if (canasParamSubscribe(pi, FIRST_MSG_ID + i, 2, cbParam, NULL) != 0 ||
+                    canasParamAdvertise(pi, FIRST_MSG_ID + NUM_PARAMS + i, false) != 0)
+                    std::exit(1);
+            }
+            elapsed += nanosNow() - started;
+            for (int i = 0; i < NUM_PARAMS; i++)
+            {
+                canasParamUnsubscribe(pi, FIRST_MSG_ID + i);
+                canasParamUnadvertise(pi, FIRST_MSG_ID + NUM_PARAMS + i);
+            }
+            // The instance has no deinit; the block allocated by canasInit() begins with the first non-empty region
+            std::free(preallocate ? static_cast<void*>(pi->arena_param_subs.pbegin) : pi->service_history.pentries);
+        }
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "startup, %i params, %s (%i allocs)", NUM_PARAMS,
+                      preallocate ? "preallocated" : "on demand", malloc_count);
+        report(name, elapsed, RUNS);
+        std::free(pi);
+    }
+}
+
+int main()
+{
+    run(false);
+    run(true);
+    return 0;
+}
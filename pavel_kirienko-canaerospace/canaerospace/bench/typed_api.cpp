@@ -0,0 +1,94 @@
+/*
+ * Typed C++ interface versus the plain C calls, for publication and reception
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include <canaerospace/canaerospace.hpp>
+#include "bench.hpp"
+
+namespace
+{
+    const int ITERATIONS = 5000000;
+    const uint16_t MSG_ID = 300;
+
+    typedef canaerospace::Param<MSG_ID, float> Pitch;
+
+    volatile float sink = 0;
+
+    /// What a C consumer has to do: check the type, then pick the union member
+    void cbRawC(CanasInstance*, const CanasParamCallbackRefArgs* pargs)
+    {
+        const CanasMessageData& data = pargs->pentry->message.data;
+        switch (data.type)
+        {
+        case CANAS_DATATYPE_FLOAT:
+            sink = data.container.FLOAT;
+            break;
+        default:
+            std::exit(1);
+        }
+    }
+
+    void benchPublish(CanasInstance* pi)
+    {
+        CanasParamHandle handle = NULL;
+        if (canasParamAdvertiseHandle(pi, MSG_ID, false, &handle) != 0)
+            std::exit(1);
+        uint64_t started = nanosNow();
+        for (int i = 0; i < ITERATIONS; i++)
+        {
+            CanasMessageData data;
+            data.type = CANAS_DATATYPE_FLOAT;
+            data.length = 0;
+            data.container.FLOAT = float(i);
+            canasParamPublishHandle(pi, handle, &data, 0);
+        }
+        report("publish, C", nanosNow() - started, ITERATIONS);
+        canasParamUnadvertise(pi, MSG_ID);
+
+        canaerospace::Publisher<Pitch> publisher;
+        if (publisher.advertise(pi) != 0)
+            std::exit(1);
+        started = nanosNow();
+        for (int i = 0; i < ITERATIONS; i++)
+            publisher.publish(pi, float(i));
+        report("publish, C++ typed", nanosNow() - started, ITERATIONS);
+        publisher.unadvertise(pi);
+    }
+
+    void runReception(CanasInstance* pi, const char* name)
+    {
+        CanasCanFrame frm = makeBenchFrame(MSG_ID, 0, 1.0f);
+        const uint64_t started = nanosNow();
+        for (int i = 0; i < ITERATIONS; i++)
+        {
+            frm.data[3] = uint8_t(i);
+            canasUpdate(pi, 0, &frm);
+        }
+        report(name, nanosNow() - started, ITERATIONS);
+    }
+
+    void benchReception(CanasInstance* pi)
+    {
+        if (canasParamSubscribeRef(pi, MSG_ID, 1, cbRawC, NULL) != 0)
+            std::exit(1);
+        runReception(pi, "receive, C");
+        canasParamUnsubscribe(pi, MSG_ID);
+
+        auto subscriber = canaerospace::makeSubscriber<Pitch>(
+            [](const float& value, const CanasParamCallbackRefArgs&) { sink = value; });
+        if (subscriber.subscribe(pi, 1) != 0)
+            std::exit(1);
+        runReception(pi, "receive, C++ typed");
+        subscriber.unsubscribe(pi);
+    }
+}
+
+int main()
+{
+    CanasInstance* pi = makeBenchInstance(makeBenchConfig());
+    benchPublish(pi);
+    benchReception(pi);
+    std::free(pi);
+    return 0;
+}
@@ -0,0 +1,78 @@
+/*
+ * Batch reception versus frame-by-frame reception
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include <sys/time.h>
+#include "bench.hpp"
+
+namespace
+{
+    const int BURST_LEN = 64;
+    const int BURSTS_PER_RUN = 20000;
+    const int NUM_SUBS = 100;
+
+    /// Same clock as in the Linux example
+    uint64_t wallclockTimestamp(CanasInstance*)
+    {
+        struct timeval tv;
+        gettimeofday(&tv, NULL);
+        return uint64_t(tv.tv_sec) * 1000000ull + tv.tv_usec;
+    }
+
+    void srvPoll(CanasInstance*, CanasServicePollCallbackArgs*) { }
+
+    CanasInstance* makeInstance()
+    {
+        CanasConfig cfg = makeBenchConfig();
+        cfg.fn_timestamp = wallclockTimestamp;
+        CanasInstance* pi = makeBenchInstance(cfg);
+        for (int i = 0; i < NUM_SUBS; i++)
+            canasParamSubscribe(pi, CANAS_MSGTYPE_NORMAL_OPERATION_MIN + i, 1, NULL, NULL);
+        canasServiceRegister(pi, 100, srvPoll, NULL, NULL, NULL);
+        return pi;
+    }
+
+    void makeBurst(CanasCanFrame* pframes, uint8_t* pifaces, int burst_index)
+    {
+        for (int i = 0; i < BURST_LEN; i++)
+        {
+            const int seq = burst_index * BURST_LEN + i;
+            pframes[i] = makeBenchFrame(CANAS_MSGTYPE_NORMAL_OPERATION_MIN + seq % NUM_SUBS,
+                                        uint8_t(seq / NUM_SUBS), 1.0f);
+            pifaces[i] = 0;
+        }
+    }
+}
+
+int main()
+{
+    CanasCanFrame frames[BURST_LEN];
+    uint8_t ifaces[BURST_LEN];
+
+    CanasInstance* pi = makeInstance();
+    uint64_t elapsed = 0;
+    for (int b = 0; b < BURSTS_PER_RUN; b++)
+    {
+        makeBurst(frames, ifaces, b);
+        const uint64_t started = nanosNow();
+        for (int i = 0; i < BURST_LEN; i++)
+            canasUpdate(pi, ifaces[i], frames + i);
+        elapsed += nanosNow() - started;
+    }
+    report("canasUpdate() x 64, per frame", elapsed, uint64_t(BURSTS_PER_RUN) * BURST_LEN);
+    std::free(pi);
+
+    pi = makeInstance();
+    elapsed = 0;
+    for (int b = 0; b < BURSTS_PER_RUN; b++)
+    {
+        makeBurst(frames, ifaces, b);
+        const uint64_t started = nanosNow();
+        canasUpdateBatch(pi, frames, ifaces, BURST_LEN);
+        elapsed += nanosNow() - started;
+    }
+    report("canasUpdateBatch() of 64, per frame", elapsed, uint64_t(BURSTS_PER_RUN) * BURST_LEN);
+    std::free(pi);
+    return 0;
+}
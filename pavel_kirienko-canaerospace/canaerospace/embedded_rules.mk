@@ -4,10 +4,18 @@
 
 _thisdir := $(dir $(lastword $(MAKEFILE_LIST)))
 
-CANAEROSPACE_SRC := $(_thisdir)/src/core.c    \
+CANAEROSPACE_SRC := $(_thisdir)/src/arena.c   \
+                    $(_thisdir)/src/core.c    \
+                    $(_thisdir)/src/history.c \
+                    $(_thisdir)/src/index.c   \
                     $(_thisdir)/src/list.c    \
                     $(_thisdir)/src/marshal.c \
+                    $(_thisdir)/src/msgclass.c \
+                    $(_thisdir)/src/param_registry.c \
+                    $(_thisdir)/src/param_registry_default.c \
+                    $(_thisdir)/src/pool.c    \
                     $(_thisdir)/src/service.c \
+                    $(_thisdir)/src/timer.c   \
                     $(_thisdir)/src/util.c    \
                     $(_thisdir)/src/generic_redundancy_resolver.c \
                     \
@@ -18,4 +26,10 @@ CANAEROSPACE_SRC := $(_thisdir)/src/core.c    \
 
 CANAEROSPACE_INC := $(_thisdir)/include/
 
-CANAEROSPACE_DEF :=
+# Two-level lookup tables, since the flat ones take about 17 KB on a 32-bit target; see README.
+# Remove this definition for the flat tables if RAM is not an issue.
+CANAEROSPACE_DEF := -DCANAEROSPACE_COMPACT_INDEX=1
+
+# Parameter set generator, see the usage notes in the script:
+#   $(CANAEROSPACE_GEN_PARAM_SET) my_params.csv generated/
+CANAEROSPACE_GEN_PARAM_SET := python3 $(_thisdir)/tools/gen_param_set.py
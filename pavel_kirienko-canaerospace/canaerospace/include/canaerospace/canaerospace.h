@@ -9,6 +9,7 @@
 #include <stdint.h>
 #include "driver.h"
 #include "message.h"
+#include "param_registry.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -34,6 +35,69 @@ static const int CANAS_IFACE_COUNT_MAX = 8;
  */
 #define CANAS_DUMP_BUF_LEN 50
 
+/**
+ * Number of distinct CAN Message IDs (11-bit Standard ID)
+ */
+#define CANAS_MSG_ID_COUNT 2048
+
+/**
+ * Number of distinct Service Codes
+ */
+#define CANAS_SERVICE_CODE_COUNT 256
+
+/**
+ * Returned by @ref canasGetNextDeadline() when the library has nothing scheduled
+ */
+#define CANAS_DEADLINE_NONE UINT64_MAX
+
+/**
+ * Lookup tables of the subscriptions, the advertisements (both keyed by Message ID) and the service subscriptions
+ * (keyed by Service Code) are dense by default, i.e. one pointer per key; that is 17 KB on a 32-bit target.
+ * Define CANAEROSPACE_COMPACT_INDEX=1 for memory-tight builds, as embedded_rules.mk does; this makes the tables
+ * two-level, with pages of @ref CANAS_INDEX_PAGE_LEN entries being allocated on demand through @ref CanasMallocFn.
+ * The memory budget of the allocator must include these pages then.
+ * The library and the application must be built with the same setting.
+ */
+#if CANAEROSPACE_COMPACT_INDEX
+#  define CANAS_INDEX_PAGE_LEN 32
+#  define CANAS_INDEX_SLOTS(num_keys) (((num_keys) + CANAS_INDEX_PAGE_LEN - 1) / CANAS_INDEX_PAGE_LEN)
+#else
+#  define CANAS_INDEX_SLOTS(num_keys) (num_keys)
+#endif
+
+/**
+ * Number of frames the instance can hold for batched transmission, see @ref canasTxBegin().
+ * The queue is flushed early if it gets full.
+ */
+#ifndef CANAS_TX_QUEUE_LEN
+#  define CANAS_TX_QUEUE_LEN 16
+#endif
+
+/**
+ * Maximum nesting level of @ref canasTxBegin(). The update functions take one level themselves.
+ */
+#define CANAS_TX_MAX_DEPTH 255
+
+/**
+ * With CANAEROSPACE_SEQLOCK, the readers of the parameter cache give up after this many attempts to catch an entry
+ * that is not being written, and report @ref CANAS_ERR_BUSY. This happens if the reader has preempted the thread
+ * that runs @ref canasUpdate() in the middle of the write, e.g. on a single core; spinning would not help then.
+ */
+#ifndef CANAS_SEQLOCK_MAX_RETRIES
+#  define CANAS_SEQLOCK_MAX_RETRIES 1000
+#endif
+
+/**
+ * Geometry of the timer wheel, see @ref canasTimerStart().
+ * One tick equals @ref CanasConfig.service_poll_interval_usec; each level has 2^BITS slots, so the default
+ * setting covers 2^16 ticks directly. Farther deadlines are allowed too, they just take a few extra cascades.
+ */
+#ifndef CANAS_TIMER_WHEEL_LEVELS
+#  define CANAS_TIMER_WHEEL_LEVELS 4
+#endif
+#define CANAS_TIMER_WHEEL_BITS  4
+#define CANAS_TIMER_WHEEL_SLOTS (1 << CANAS_TIMER_WHEEL_BITS)
+
 /**
  * Nearly all API calls return an error code.
  * @note API calls return the negative error codes. You have to invert the sign to get the actual error code.
@@ -58,7 +122,8 @@ typedef enum
     CANAS_ERR_BAD_CAN_FRAME,
 
     CANAS_ERR_QUOTA_EXCEEDED,
-    CANAS_ERR_LOGIC                 ///< May be returned by a service if it goes wrong
+    CANAS_ERR_LOGIC,                ///< May be returned by a service if it goes wrong
+    CANAS_ERR_BUSY                  ///< Parameter cache entry is being written, see @ref CANAS_SEQLOCK_MAX_RETRIES
 } CanasErrorCode;
 
 typedef struct CanasInstanceStruct CanasInstance;
@@ -72,6 +137,16 @@ typedef struct CanasInstanceStruct CanasInstance;
  */
 typedef int (*CanasCanSendFn)(CanasInstance*, int, const CanasCanFrame*);
 
+/**
+ * Send a number of frames to the bus at once. Used for the queued frames, see @ref canasTxBegin().
+ * @param [in] pi      Instance pointer
+ * @param [in] iface   Interface index
+ * @param [in] pframes Pointer to an array of frames to be sent in order
+ * @param [in] nframes Length of the array
+ * @return             Number of frames sent, negative on failure
+ */
+typedef int (*CanasCanSendManyFn)(CanasInstance*, int, const CanasCanFrame*, int);
+
 /**
  * Configure acceptance filters.
  * @param [in] pi       Instance pointer
@@ -87,6 +162,7 @@ typedef int (*CanasCanFilterFn)(CanasInstance*, int, const CanasCanFilterConfig*
  * If the application does not require de-initialization features like unsubscription of unadvertisement, then dynamic
  * memory is not needed at all. If this is the case, you can use a static pool allocator.
  * This feature is useful for embedded systems where dynamic memory is not always available.
+ * If the memory must be freed as well, the library provides a pool allocator with deallocation support (pool.h).
  * @note Allocated memory must be aligned properly.
  * @param [in] pi   Instance pointer
  * @param [in] size Size of the memory block required
@@ -120,6 +196,20 @@ typedef struct
 } CanasHookCallbackArgs;
 typedef void (*CanasHookCallbackFn)(CanasInstance*, CanasHookCallbackArgs*);
 
+/**
+ * Zero-copy callback arguments.
+ * They refer to the library's own copy of the message, which is only valid until the callback returns.
+ */
+typedef struct
+{
+    uint64_t timestamp_usec;
+    const CanasMessage* pmessage;
+    uint16_t message_id;
+    uint8_t redund_channel_id;
+    uint8_t iface;
+} CanasHookCallbackRefArgs;
+typedef void (*CanasHookCallbackRefFn)(CanasInstance*, const CanasHookCallbackRefArgs*);
+
 typedef struct
 {
     uint64_t timestamp_usec;
@@ -137,6 +227,11 @@ typedef struct
 } CanasServicePollCallbackArgs;
 typedef void (*CanasServicePollCallbackFn)(CanasInstance*, CanasServicePollCallbackArgs*);
 
+/**
+ * Returns the earliest timestamp when the service needs to be polled, or @ref CANAS_DEADLINE_NONE if it is idle.
+ */
+typedef uint64_t (*CanasServiceDeadlineCallbackFn)(CanasInstance*, void* pstate);
+
 typedef struct
 {
     uint64_t timestamp_usec;
@@ -146,6 +241,15 @@ typedef struct
 } CanasServiceRequestCallbackArgs;
 typedef void (*CanasServiceRequestCallbackFn)(CanasInstance*, CanasServiceRequestCallbackArgs*);
 
+typedef struct
+{
+    uint64_t timestamp_usec;
+    void* pstate;
+    const CanasMessage* pmessage;
+    uint8_t service_channel;
+} CanasServiceRequestCallbackRefArgs;
+typedef void (*CanasServiceRequestCallbackRefFn)(CanasInstance*, const CanasServiceRequestCallbackRefArgs*);
+
 typedef struct
 {
     uint64_t timestamp_usec;
@@ -156,34 +260,76 @@ typedef void (*CanasServiceResponseCallbackFn)(CanasInstance*, CanasServiceRespo
 
 typedef struct
 {
-    uint64_t timestamp_usec;        ///< Empty entry contains zero timestamp
+    uint64_t timestamp_usec;
+    void* pstate;
+    const CanasMessage* pmessage;
+} CanasServiceResponseCallbackRefArgs;
+typedef void (*CanasServiceResponseCallbackRefFn)(CanasInstance*, const CanasServiceResponseCallbackRefArgs*);
+
+typedef struct
+{
+    uint64_t timestamp_usec;
     uint32_t header;                ///< First 4 bytes of frame
-    uint8_t ifaces_mask;
+    uint8_t ifaces_mask;            ///< Empty entry has no interfaces marked
+    uint8_t older;                  ///< Index + 1 of the previous entry with the same header, or 0
 } CanasServiceFrameHistoryEntry;
 
+/**
+ * Recently received service frames, for repetition detection.
+ * Entries are replaced in the order of their arrival; the hash table maps the frame header to the newest entry,
+ * which is chained with the older entries of the same header.
+ * The header contains the service code, so one history is shared by all services of the instance.
+ */
+typedef struct
+{
+    CanasServiceFrameHistoryEntry* pentries;
+    uint8_t* pslots;                ///< Open-addressed hash table; entry index + 1, or 0 if empty
+    uint16_t slots_mask;
+    uint8_t len;
+    uint8_t next;                   ///< Oldest entry, will be replaced next
+} CanasServiceHistory;
+
 typedef struct
 {
     void* pnext;                    ///< Must be the first entry
     CanasServicePollCallbackFn callback_poll;
+    CanasServiceDeadlineCallbackFn callback_deadline;
     CanasServiceRequestCallbackFn callback_request;
     CanasServiceResponseCallbackFn callback_response;
+    CanasServiceRequestCallbackRefFn callback_request_ref;
+    CanasServiceResponseCallbackRefFn callback_response_ref;
     void* pstate;
     uint8_t service_code;
-    uint8_t history_len;
-    CanasServiceFrameHistoryEntry history[1]; // flexible
 } CanasServiceSubscription;
 
+/**
+ * Build the library with CANAEROSPACE_SEQLOCK=1 to let other threads read the parameter cache without locks, see
+ * @ref canasParamRead(). The sequence counter is maintained then; the write side stays single-threaded, and the
+ * readers never block it. A reader that keeps finding the entry in the middle of a write gives up with an error.
+ * This requires the GCC atomic builtins. The layout does not depend on this setting.
+ */
 typedef struct
 {
     uint64_t timestamp_usec;        ///< Empty entry contains zero timestamp
     CanasMessage message;
+    uint32_t seq;                   ///< Odd while the entry is being written; stays zero without CANAEROSPACE_SEQLOCK
 } CanasParamCacheEntry;
 
 typedef struct
 {
-    void* pnext;                    ///< Must be the first entry
+    void* parg;
+    const CanasParamCacheEntry* pentry; ///< Freshly updated cache entry, contains the message and its timestamp
+    uint16_t message_id;
+    uint8_t redund_channel_id;
+} CanasParamCallbackRefArgs;
+typedef void (*CanasParamCallbackRefFn)(CanasInstance*, const CanasParamCallbackRefArgs*);
+
+typedef struct
+{
     CanasParamCallbackFn callback;
+    CanasParamCallbackRefFn callback_ref;
     void* callback_arg;
+    uint32_t type_mask;             ///< Data types allowed by the registry; zero if the parameter is not registered
     uint16_t message_id;
     uint8_t redund_count;
     CanasParamCacheEntry redund_cache[1]; // flexible
@@ -191,37 +337,157 @@ typedef struct
 
 typedef struct
 {
-    void* pnext;                    ///< Must be the first entry
+    uint16_t message_id;
+    uint8_t redund_chan;
+} CanasParamSnapshotItem;
+
+/**
+ * Precomputed list of the cache entries to be copied by @ref canasParamSnapshotTake().
+ * It refers to the subscriptions directly, so it must be initialized again once any of them is unsubscribed.
+ */
+typedef struct
+{
+    const CanasInstance* pi;
+    const CanasParamCacheEntry** ppentries;     ///< Storage is provided by the application, one pointer per item
+    uint16_t num_items;
+} CanasParamSnapshot;
+
+/**
+ * Output of @ref canasParamSnapshotTake(), one array per field. Each array has one element per snapshot item,
+ * in the order of the items. Any array can be NULL if the application does not need it.
+ */
+typedef struct
+{
+    CanasMessageData* pvalues;
+    uint64_t* ptimestamps_usec;         ///< Zero if nothing was received yet
+    uint8_t* pmessage_codes;
+    uint8_t* pfresh;                    ///< Nonzero if the entry is not older than the specified age
+} CanasParamSnapshotData;
+
+typedef struct CanasParamAdvertisementStruct
+{
+    CanasCanFrame frame;            ///< Prebuilt at advertisement; CAN ID and Node ID never change
     uint16_t message_id;
     uint8_t message_code;
     int8_t interlacing_next_iface;
 } CanasParamAdvertisement;
 
+/**
+ * Opaque publication handle, see @ref canasParamAdvertiseHandle().
+ * It stays valid until the parameter is unadvertised.
+ */
+typedef struct CanasParamAdvertisementStruct* CanasParamHandle;
+
+/**
+ * Size of the subscription with the given number of redundancy channels, rounded up to keep the alignment.
+ */
+#define CANAS_PARAM_SUBSCRIPTION_SIZE(redund_count) \
+    ((sizeof(CanasParamSubscription) + sizeof(CanasParamCacheEntry) * ((redund_count) - 1) + 7) / 8 * 8)
+
+typedef struct
+{
+    uint16_t message_id;
+    uint8_t redund_count;
+    CanasParamCallbackFn callback;  ///< Either this or callback_ref, or none
+    CanasParamCallbackRefFn callback_ref;
+    void* callback_arg;
+} CanasStaticSubscription;
+
+typedef struct
+{
+    uint16_t message_id;
+    bool interlaced;
+} CanasStaticAdvertisement;
+
+/**
+ * Subscriptions and advertisements known at build time; see static_table.h for the helper macros.
+ * The table itself can be placed in ROM, only the storage must be writable.
+ */
+typedef struct
+{
+    const CanasStaticSubscription* psubscriptions;
+    uint64_t* psubscription_storage;        ///< Sum of @ref CANAS_PARAM_SUBSCRIPTION_SIZE() of all subscriptions
+    uint16_t num_subscriptions;
+
+    const CanasStaticAdvertisement* padvertisements;
+    CanasParamAdvertisement* padvertisement_storage;  ///< One per advertisement
+    uint16_t num_advertisements;
+} CanasStaticTable;
+
 typedef struct
 {
     CanasCanSendFn fn_send;         ///< Required
     CanasCanFilterFn fn_filter;     ///< May be null if filters are not available
+    CanasCanSendManyFn fn_send_many;///< Optional, enables batched transmission
 
     CanasTimestampFn fn_timestamp;  ///< Required
 
     CanasMallocFn fn_malloc;        ///< Required; read the notes @ref CanasMallocFn
     CanasFreeFn fn_free;            ///< Optional, may be NULL. Read the notes @ref CanasFreeFn
+    void* pmem_state;               ///< For use by fn_malloc and fn_free, e.g. a pool (see pool.h)
 
     CanasHookCallbackFn fn_hook;    ///< Should be null if not used
+    CanasHookCallbackRefFn fn_hook_ref; ///< Zero-copy alternative to fn_hook, should be null if not used
 
     uint8_t iface_count;            ///< Number of interfaces available
     uint8_t filters_per_iface;      ///< Number of filters per interface. May be 0 if no filters available.
 
     uint32_t service_request_timeout_usec;///< Time to wait for response from remote node. Default is okay.
     uint16_t service_poll_interval_usec;  ///< Do not change
-    uint8_t service_frame_hist_len;       ///< Do not change
+    uint8_t service_frame_hist_len;       ///< Service frames to remember for repetition detection, for all services
     uint8_t service_channel;              ///< Service channel of the Local Node. May be of high or low priority.
     uint32_t repeat_timeout_usec;         ///< Largest interval of repeated messages (default should be good enough)
 
     uint8_t node_id;                ///< Local Node ID
     uint8_t redund_channel_id;      ///< Local Node Redundancy Channel ID
+
+    /*
+     * Capacity hints. The storage for this many entries is preallocated by @ref canasInit() in one block, so the
+     * subscription, advertisement and registration calls within these limits don't allocate memory.
+     * The entries beyond the limits are allocated on demand as usual. Zero means no preallocation.
+     */
+    uint16_t max_param_subscriptions;
+    uint8_t max_redund_channels;    ///< Largest redundancy channel count of the preallocated subscriptions
+    uint16_t max_param_advertisements;
+    uint8_t max_services;
+
+    const CanasStaticTable* pstatic_table;  ///< Optional, loaded by @ref canasInit() without allocating memory
+
+    /**
+     * Optional, e.g. &canas_param_registry_default. Received parameters that are registered there are accepted
+     * only with the allowed data types, otherwise the update reports @ref CANAS_ERR_BAD_DATA_TYPE; unregistered
+     * parameters are accepted with any data type.
+     */
+    const CanasParamRegistry* pparam_registry;
 } CanasConfig;
 
+/**
+ * Preallocated blocks of one kind, see the capacity hints in @ref CanasConfig.
+ */
+typedef struct
+{
+    void* pfree;                    ///< List of free blocks
+    uint8_t* pbegin;
+    uint8_t* pend;
+    uint16_t block_size;
+} CanasArenaRegion;
+
+typedef struct CanasTimerStruct CanasTimer;
+typedef void (*CanasTimerCallbackFn)(CanasInstance*, CanasTimer*, uint64_t timestamp_usec);
+
+/**
+ * Timer is meant to be embedded into the state of its owner, so the library does not allocate memory for it.
+ * It must be zero-initialized before the first use, and it must not be erased or freed while pending.
+ */
+struct CanasTimerStruct
+{
+    CanasTimer* pnext;
+    CanasTimer** ppprev;            ///< Points to the link that points to this timer; NULL if not pending
+    uint64_t deadline_usec;
+    CanasTimerCallbackFn callback;
+    void* parg;                     ///< To be used by the owner
+};
+
 struct CanasInstanceStruct
 {
     CanasConfig config;
@@ -230,8 +496,28 @@ struct CanasInstanceStruct
     uint64_t last_service_ts;
 
     CanasServiceSubscription* pservice_subs;
-    CanasParamSubscription* pparam_subs;
-    CanasParamAdvertisement* pparam_advs;
+    CanasServiceHistory service_history;           ///< Shared by all services, allocated by canasInit()
+
+    CanasArenaRegion arena_param_subs;
+    CanasArenaRegion arena_param_advs;
+    CanasArenaRegion arena_services;
+    const uint8_t* pstatic_subs_end;               ///< End of the used storage of the static subscriptions
+
+    void* param_sub_index[CANAS_INDEX_SLOTS(CANAS_MSG_ID_COUNT)];    ///< Message ID --> CanasParamSubscription
+    void* param_adv_index[CANAS_INDEX_SLOTS(CANAS_MSG_ID_COUNT)];    ///< Message ID --> CanasParamAdvertisement
+    void* service_index[CANAS_INDEX_SLOTS(CANAS_SERVICE_CODE_COUNT)];///< Service Code --> CanasServiceSubscription
+
+    uint32_t param_interest[CANAS_MSG_ID_COUNT / 32];                ///< One bit per subscribed Message ID
+
+    CanasCanFrame tx_queue[CANAS_TX_QUEUE_LEN];
+    uint8_t tx_queue_ifaces[CANAS_TX_QUEUE_LEN];   ///< Bit mask of destination interfaces for each queued frame
+    uint8_t tx_queue_len;
+    uint8_t tx_depth;                              ///< Nesting level of canasTxBegin()
+    int tx_error;                                  ///< First error of the early flushes, see canasTxEnd()
+
+    CanasTimer* timer_wheel[CANAS_TIMER_WHEEL_LEVELS][CANAS_TIMER_WHEEL_SLOTS];
+    uint64_t timer_tick;                           ///< Current position of the wheel
+    uint32_t timer_count;                          ///< Number of pending timers
 };
 
 /**
@@ -242,6 +528,9 @@ CanasConfig canasMakeConfig(void);
 
 /**
  * Initialize instance.
+ * The service frame history is allocated here, its size is defined by @ref CanasConfig.service_frame_hist_len.
+ * The storage defined by the capacity hints in @ref CanasConfig is allocated in the same block.
+ * Then the static table is loaded, if any; its entries can be unsubscribed and unadvertised as usual.
  * @param [out] pi    Pointer to instance to be initialized
  * @param [in]  pcfg  Pointer to the instance configuration
  * @param [in]  pthis Application-specific pointer, goes to the corresponding instance field.
@@ -252,7 +541,9 @@ int canasInit(CanasInstance* pi, const CanasConfig* pcfg, void* pthis);
 /**
  * Update instance state.
  * Must be called for every new incoming frame or by timeout.
- * @note It is recommended to call this function at least every 10 ms
+ * If the frame carries a reception timestamp (@ref CanasCanFrame), it will be used for this frame instead of the
+ * current time; this applies to @ref canasUpdateBatch() as well, but not to @ref canasUpdateAt().
+ * Besides the incoming frames, it must be called not later than @ref canasGetNextDeadline().
  * @param [in] pi     Instance pointer
  * @param [in] iface  Interface index from which the frame was received; ignored when no frame provided
  * @param [in] pframe Pointer to the received frame, NULL when called by timeout
@@ -260,6 +551,63 @@ int canasInit(CanasInstance* pi, const CanasConfig* pcfg, void* pthis);
  */
 int canasUpdate(CanasInstance* pi, int iface, const CanasCanFrame* pframe);
 
+/**
+ * Same as @ref canasUpdate(), but the timestamp is provided by the caller instead of @ref CanasTimestampFn.
+ * This is useful when the driver knows the exact reception time of the frame.
+ * The timestamp must come from the same time base as @ref CanasTimestampFn.
+ * It takes precedence over the reception timestamp of the frame, which is ignored by this function.
+ * @param [in] pi             Instance pointer
+ * @param [in] iface          Interface index from which the frame was received; ignored when no frame provided
+ * @param [in] pframe         Pointer to the received frame, NULL when called by timeout
+ * @param [in] timestamp_usec Reception time of the frame, or current time when called by timeout
+ * @return                    @ref CanasErrorCode
+ */
+int canasUpdateAt(CanasInstance* pi, int iface, const CanasCanFrame* pframe, uint64_t timestamp_usec);
+
+/**
+ * Same as @ref canasUpdate(), but for a burst of frames, e.g. when the driver has several frames queued.
+ * The clock is read once, and the services are polled once, after all frames were processed in order.
+ * Frames that carry their own reception timestamps will be processed with them.
+ * A malformed frame does not prevent processing of the remaining ones.
+ * @param [in] pi      Instance pointer
+ * @param [in] pframes Array of the received frames
+ * @param [in] pifaces Array of interface indexes, one per frame
+ * @param [in] nframes Number of frames, may be zero
+ * @return             @ref CanasErrorCode of the first frame that failed, or 0
+ */
+int canasUpdateBatch(CanasInstance* pi, const CanasCanFrame* pframes, const uint8_t* pifaces, int nframes);
+
+/**
+ * Returns the time when the library needs to be updated even if no frames arrive, from the same time base as
+ * @ref CanasTimestampFn. The application can sleep until then instead of calling @ref canasUpdate() periodically.
+ * Services that don't report their deadlines will be polled every @ref CanasConfig.service_poll_interval_usec.
+ * The result may be in the past; it must be queried again after every update or service call.
+ * @return Absolute timestamp in microseconds, or @ref CANAS_DEADLINE_NONE
+ */
+uint64_t canasGetNextDeadline(CanasInstance* pi);
+
+/**
+ * Batched transmission.
+ * If @ref CanasConfig.fn_send_many is set, the frames sent between these calls are queued, and then
+ * flushed by the outermost canasTxEnd() with one call of fn_send_many per interface. The calls can be nested.
+ * The update functions do the same internally, so the frames sent from the callbacks are batched too.
+ * Functions that send a frame while the queue is held will not report driver errors; canasTxEnd() will.
+ * The frames that fn_send_many did not take are sent one by one with fn_send; if a frame could not be sent to
+ * any of its interfaces even then, the flush reports @ref CANAS_ERR_DRIVER. If the queue was flushed early because
+ * it got full, the outermost canasTxEnd() reports the first error of those flushes as well.
+ * Without fn_send_many these calls have no effect.
+ * @{
+ */
+/**
+ * @return 0, or @ref CANAS_ERR_QUOTA_EXCEEDED if @ref CANAS_TX_MAX_DEPTH calls are nested already; canasTxEnd()
+ *         must not be called for a failed canasTxBegin().
+ */
+int canasTxBegin(CanasInstance* pi);
+int canasTxEnd(CanasInstance* pi);
+/**
+ * @}
+ */
+
 /**
  * Parameter subscriptions.
  * Each parameter must be subscribed before you can read it from the bus.
@@ -269,8 +617,50 @@ int canasUpdate(CanasInstance* pi, int iface, const CanasCanFrame* pframe);
  */
 int canasParamSubscribe(CanasInstance* pi, uint16_t msg_id, uint8_t redund_chan_count, CanasParamCallbackFn callback,
                         void* callback_arg);
+/**
+ * Same as above, but the callback receives a pointer to the updated cache entry instead of a copy of the message.
+ * This is the preferred option for high-rate parameters.
+ */
+int canasParamSubscribeRef(CanasInstance* pi, uint16_t msg_id, uint8_t redund_chan_count,
+                           CanasParamCallbackRefFn callback, void* callback_arg);
 int canasParamUnsubscribe(CanasInstance* pi, uint16_t msg_id);
+/**
+ * With CANAEROSPACE_SEQLOCK, this function can be called from any thread concurrently with the thread that runs
+ * @ref canasUpdate(); the entry is never torn. The subscriptions must not be changed meanwhile.
+ * The reader does not wait for the writer, so a reader that preempts the writer on the same core gets
+ * @ref CANAS_ERR_BUSY; it should let the writer run (e.g. sleep for a tick) and try again.
+ */
 int canasParamRead(CanasInstance* pi, uint16_t msg_id, uint8_t redund_chan, CanasParamCallbackArgs* pargs);
+/**
+ * Consistent copy of the cache entry, for those who keep the pointer to it, e.g. from @ref CanasParamCallbackRefArgs.
+ * Thread safety is the same as of @ref canasParamRead().
+ * @return 0 or -CANAS_ERR_BUSY
+ */
+int canasParamCacheCopy(const CanasParamCacheEntry* psrc, CanasParamCacheEntry* pdst);
+/**
+ * Resolve the (Message ID, redundancy channel) pairs into the snapshot.
+ * All of the parameters must be subscribed already.
+ * @param [in]  pi         Instance pointer
+ * @param [out] psnap      Snapshot to be initialized
+ * @param [in]  pitems     Parameters to be copied; not referenced after the call
+ * @param [in]  num_items  Number of items
+ * @param [in]  ppentries  Storage for num_items pointers, must outlive the snapshot
+ */
+int canasParamSnapshotInit(CanasInstance* pi, CanasParamSnapshot* psnap, const CanasParamSnapshotItem* pitems,
+                           int num_items, const CanasParamCacheEntry** ppentries);
+/**
+ * Copy all the items of the snapshot in one pass.
+ * With CANAEROSPACE_SEQLOCK, the copy is consistent as a whole: none of its entries was written while it was being
+ * taken; updates of the other parameters do not interfere. Thread safety is the same as of @ref canasParamRead(),
+ * including @ref CANAS_ERR_BUSY; the output arrays are undefined then.
+ * @param [in]  psnap           Snapshot
+ * @param [in]  timestamp_usec  Current time, to evaluate the freshness
+ * @param [in]  max_age_usec    Entries older than that are not fresh; zero accepts any received entry
+ * @param [out] pdata           Output arrays
+ * @return                      Number of fresh entries or negative @ref CanasErrorCode
+ */
+int canasParamSnapshotTake(const CanasParamSnapshot* psnap, uint64_t timestamp_usec, uint64_t max_age_usec,
+                           CanasParamSnapshotData* pdata);
 /**
  * @}
  */
@@ -285,6 +675,13 @@ int canasParamRead(CanasInstance* pi, uint16_t msg_id, uint8_t redund_chan, Cana
 int canasParamAdvertise(CanasInstance* pi, uint16_t msg_id, bool interlaced);
 int canasParamUnadvertise(CanasInstance* pi, uint16_t msg_id);
 int canasParamPublish(CanasInstance* pi, uint16_t msg_id, const CanasMessageData* pdata, uint8_t service_code);
+/**
+ * Same as above, but the advertisement is addressed by handle rather than by Message ID.
+ * This is the fastest way to publish a parameter: no lookup is performed and the frame header is prebuilt.
+ */
+int canasParamAdvertiseHandle(CanasInstance* pi, uint16_t msg_id, bool interlaced, CanasParamHandle* phandle);
+int canasParamPublishHandle(CanasInstance* pi, CanasParamHandle handle, const CanasMessageData* pdata,
+                            uint8_t service_code);
 /**
  * @}
  */
@@ -300,6 +697,17 @@ int canasServiceSendResponse(CanasInstance* pi, const CanasMessage* pmsg, uint8_
 int canasServiceRegister(CanasInstance* pi, uint8_t service_code, CanasServicePollCallbackFn callback_poll,
                          CanasServiceRequestCallbackFn callback_request,
                          CanasServiceResponseCallbackFn callback_response, void* pstate);
+/**
+ * Same as above, with zero-copy request and response callbacks.
+ */
+int canasServiceRegisterRef(CanasInstance* pi, uint8_t service_code, CanasServicePollCallbackFn callback_poll,
+                            CanasServiceRequestCallbackRefFn callback_request,
+                            CanasServiceResponseCallbackRefFn callback_response, void* pstate);
+/**
+ * Optional; lets the service tell @ref canasGetNextDeadline() when it needs to be polled next.
+ * Without it, the service will be polled at a fixed interval.
+ */
+int canasServiceSetDeadlineCallback(CanasInstance* pi, uint8_t service_code, CanasServiceDeadlineCallbackFn callback);
 int canasServiceUnregister(CanasInstance* pi, uint8_t service_code);
 int canasServiceSetState(CanasInstance* pi, uint8_t service_code, void* pstate);
 int canasServiceGetState(CanasInstance* pi, uint8_t service_code, void** ppstate);
@@ -307,6 +715,22 @@ int canasServiceGetState(CanasInstance* pi, uint8_t service_code, void** ppstate
  * @}
  */
 
+/**
+ * Timers for the services.
+ * The callback is invoked from the update functions once the timestamp reaches the deadline; at this point the timer
+ * is not pending anymore, so the callback may restart it or release its memory. Deadlines are also taken into
+ * account by @ref canasGetNextDeadline(). Starting a pending timer reschedules it.
+ * Cost of both operations does not depend on the number of pending timers.
+ * @{
+ */
+int canasTimerStart(CanasInstance* pi, CanasTimer* ptimer, uint64_t deadline_usec, CanasTimerCallbackFn callback,
+                    void* parg);
+void canasTimerStop(CanasInstance* pi, CanasTimer* ptimer);
+bool canasTimerIsPending(const CanasTimer* ptimer);
+/**
+ * @}
+ */
+
 /**
  * Dump a CAN frame for humans.
  * @param [in]  pframe Pointer to frame to be dumped
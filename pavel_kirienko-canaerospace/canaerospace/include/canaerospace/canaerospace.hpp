@@ -0,0 +1,309 @@
+/*
+ * Typed C++ interface for parameters, header-only
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#ifndef CANAEROSPACE_HPP_
+#define CANAEROSPACE_HPP_
+
+#if __cplusplus < 201103L
+#  error "C++11 or newer is required"
+#endif
+
+#include <array>
+#include <cstring>
+#include <type_traits>
+#include "canaerospace.h"
+
+namespace canaerospace
+{
+/**
+ * Binds a CANaerospace data type to the C++ type and to the member of @ref CanasDataContainer.
+ * The member is selected at compile time, so no switch over the data type is needed.
+ */
+template <uint8_t TypeID>
+struct DataType;
+
+#define CANAS_CPP_SCALAR_TYPE_(type_id, cpp_type, member) \
+    template <> \
+    struct DataType<type_id> \
+    { \
+        typedef cpp_type ValueType; \
+        static ValueType get(const CanasDataContainer& c) { return c.member; } \
+        static void set(CanasDataContainer& c, const ValueType& value) { c.member = value; } \
+    };
+
+#define CANAS_CPP_ARRAY_TYPE_(type_id, cpp_type, size, member) \
+    template <> \
+    struct DataType<type_id> \
+    { \
+        typedef std::array<cpp_type, size> ValueType; \
+        static ValueType get(const CanasDataContainer& c) \
+        { \
+            ValueType value; \
+            std::memcpy(value.data(), c.member, sizeof(c.member)); \
+            return value; \
+        } \
+        static void set(CanasDataContainer& c, const ValueType& value) \
+        { \
+            std::memcpy(c.member, value.data(), sizeof(c.member)); \
+        } \
+    };
+
+CANAS_CPP_SCALAR_TYPE_(CANAS_DATATYPE_ERROR,   uint32_t, ERROR)
+CANAS_CPP_SCALAR_TYPE_(CANAS_DATATYPE_FLOAT,   float,    FLOAT)
+CANAS_CPP_SCALAR_TYPE_(CANAS_DATATYPE_LONG,    int32_t,  LONG)
+CANAS_CPP_SCALAR_TYPE_(CANAS_DATATYPE_ULONG,   uint32_t, ULONG)
+CANAS_CPP_SCALAR_TYPE_(CANAS_DATATYPE_BLONG,   uint32_t, BLONG)
+CANAS_CPP_SCALAR_TYPE_(CANAS_DATATYPE_SHORT,   int16_t,  SHORT)
+CANAS_CPP_SCALAR_TYPE_(CANAS_DATATYPE_USHORT,  uint16_t, USHORT)
+CANAS_CPP_SCALAR_TYPE_(CANAS_DATATYPE_BSHORT,  uint16_t, BSHORT)
+CANAS_CPP_SCALAR_TYPE_(CANAS_DATATYPE_CHAR,    int8_t,   CHAR)
+CANAS_CPP_SCALAR_TYPE_(CANAS_DATATYPE_UCHAR,   uint8_t,  UCHAR)
+CANAS_CPP_SCALAR_TYPE_(CANAS_DATATYPE_BCHAR,   uint8_t,  BCHAR)
+CANAS_CPP_ARRAY_TYPE_ (CANAS_DATATYPE_SHORT2,  int16_t,  2, SHORT2)
+CANAS_CPP_ARRAY_TYPE_ (CANAS_DATATYPE_USHORT2, uint16_t, 2, USHORT2)
+CANAS_CPP_ARRAY_TYPE_ (CANAS_DATATYPE_BSHORT2, uint16_t, 2, BSHORT2)
+CANAS_CPP_ARRAY_TYPE_ (CANAS_DATATYPE_CHAR4,   int8_t,   4, CHAR4)
+CANAS_CPP_ARRAY_TYPE_ (CANAS_DATATYPE_UCHAR4,  uint8_t,  4, UCHAR4)
+CANAS_CPP_ARRAY_TYPE_ (CANAS_DATATYPE_BCHAR4,  uint8_t,  4, BCHAR4)
+CANAS_CPP_ARRAY_TYPE_ (CANAS_DATATYPE_CHAR2,   int8_t,   2, CHAR2)
+CANAS_CPP_ARRAY_TYPE_ (CANAS_DATATYPE_UCHAR2,  uint8_t,  2, UCHAR2)
+CANAS_CPP_ARRAY_TYPE_ (CANAS_DATATYPE_BCHAR2,  uint8_t,  2, BCHAR2)
+CANAS_CPP_SCALAR_TYPE_(CANAS_DATATYPE_MEMID,   uint32_t, MEMID)
+CANAS_CPP_SCALAR_TYPE_(CANAS_DATATYPE_CHKSUM,  uint32_t, CHKSUM)
+CANAS_CPP_SCALAR_TYPE_(CANAS_DATATYPE_ACHAR,   uint8_t,  ACHAR)
+CANAS_CPP_ARRAY_TYPE_ (CANAS_DATATYPE_ACHAR2,  uint8_t,  2, ACHAR2)
+CANAS_CPP_ARRAY_TYPE_ (CANAS_DATATYPE_ACHAR4,  uint8_t,  4, ACHAR4)
+CANAS_CPP_ARRAY_TYPE_ (CANAS_DATATYPE_CHAR3,   int8_t,   3, CHAR3)
+CANAS_CPP_ARRAY_TYPE_ (CANAS_DATATYPE_UCHAR3,  uint8_t,  3, UCHAR3)
+CANAS_CPP_ARRAY_TYPE_ (CANAS_DATATYPE_BCHAR3,  uint8_t,  3, BCHAR3)
+CANAS_CPP_ARRAY_TYPE_ (CANAS_DATATYPE_ACHAR3,  uint8_t,  3, ACHAR3)
+CANAS_CPP_SCALAR_TYPE_(CANAS_DATATYPE_DOUBLEH, uint32_t, DOUBLEH)
+CANAS_CPP_SCALAR_TYPE_(CANAS_DATATYPE_DOUBLEL, uint32_t, DOUBLEL)
+
+#undef CANAS_CPP_SCALAR_TYPE_
+#undef CANAS_CPP_ARRAY_TYPE_
+
+/**
+ * Data type used when only the C++ type is given; other data types must be specified explicitly.
+ */
+template <typename T> struct DefaultDataType;
+template <> struct DefaultDataType<float>    { static constexpr uint8_t value = CANAS_DATATYPE_FLOAT; };
+template <> struct DefaultDataType<int32_t>  { static constexpr uint8_t value = CANAS_DATATYPE_LONG; };
+template <> struct DefaultDataType<uint32_t> { static constexpr uint8_t value = CANAS_DATATYPE_ULONG; };
+template <> struct DefaultDataType<int16_t>  { static constexpr uint8_t value = CANAS_DATATYPE_SHORT; };
+template <> struct DefaultDataType<uint16_t> { static constexpr uint8_t value = CANAS_DATATYPE_USHORT; };
+template <> struct DefaultDataType<int8_t>   { static constexpr uint8_t value = CANAS_DATATYPE_CHAR; };
+template <> struct DefaultDataType<uint8_t>  { static constexpr uint8_t value = CANAS_DATATYPE_UCHAR; };
+template <> struct DefaultDataType<std::array<int16_t, 2> >
+    { static constexpr uint8_t value = CANAS_DATATYPE_SHORT2; };
+template <> struct DefaultDataType<std::array<uint16_t, 2> >
+    { static constexpr uint8_t value = CANAS_DATATYPE_USHORT2; };
+template <> struct DefaultDataType<std::array<int8_t, 2> >
+    { static constexpr uint8_t value = CANAS_DATATYPE_CHAR2; };
+template <> struct DefaultDataType<std::array<uint8_t, 2> >
+    { static constexpr uint8_t value = CANAS_DATATYPE_UCHAR2; };
+template <> struct DefaultDataType<std::array<int8_t, 3> >
+    { static constexpr uint8_t value = CANAS_DATATYPE_CHAR3; };
+template <> struct DefaultDataType<std::array<uint8_t, 3> >
+    { static constexpr uint8_t value = CANAS_DATATYPE_UCHAR3; };
+template <> struct DefaultDataType<std::array<int8_t, 4> >
+    { static constexpr uint8_t value = CANAS_DATATYPE_CHAR4; };
+template <> struct DefaultDataType<std::array<uint8_t, 4> >
+    { static constexpr uint8_t value = CANAS_DATATYPE_UCHAR4; };
+
+/**
+ * @return Data type if the mask has exactly one bit set, otherwise -1
+ */
+constexpr int singleTypeOf(uint32_t type_mask, int type_id = 0)
+{
+    return (type_mask == 0 || (type_mask & (type_mask - 1)) != 0) ? -1 :
+           ((type_mask & 1) ? type_id : singleTypeOf(type_mask >> 1, type_id + 1));
+}
+
+/**
+ * Data types allowed for a Message ID, as a mask of @ref CANAS_PARAM_TYPE_BIT().
+ * Unbound IDs accept any data type. The standard IDs are bound in param_id/param_bindings.hpp, which is generated
+ * from the ID headers; it is not included by default, like the registry on the C side is optional, so the
+ * applications that follow the standard ID distribution include it explicitly. The parameter sets generated by
+ * tools/gen_param_set.py bind their own IDs.
+ * Other IDs can be bound by the application, in the namespace canaerospace:
+ *   CANAS_CPP_PARAM_BINDING(MY_MSG_ID, CANAS_PARAM_TYPE_BIT(CANAS_DATATYPE_FLOAT))
+ */
+template <uint16_t MessageID>
+struct ParamBinding
+{
+    static constexpr uint32_t type_mask = 0;
+    static constexpr int type_id = -1;
+};
+
+/**
+ * type_id is set only if exactly one data type is allowed.
+ */
+#define CANAS_CPP_PARAM_BINDING(message_id, type_mask_) \
+    template <> \
+    struct ParamBinding<message_id> \
+    { \
+        static constexpr uint32_t type_mask = (type_mask_); \
+        static constexpr int type_id = singleTypeOf(type_mask); \
+    };
+
+/**
+ * @return True if the data type is allowed for the Message ID
+ */
+template <uint16_t MessageID>
+constexpr bool isTypeAllowed(uint8_t type_id)
+{
+    return ParamBinding<MessageID>::type_mask == 0 ||
+           (type_id < 32 && ((ParamBinding<MessageID>::type_mask >> type_id) & 1) != 0);
+}
+
+/**
+ * Parameter with the Message ID and the data type known at compile time:
+ *   typedef canaerospace::Param<CANAS_NOD_DEF_BODY_PITCH_RATE, float> PitchRate;
+ *   PitchRate::publish(pi, 1.5f);
+ */
+template <uint16_t MessageID, typename T, uint8_t TypeID = DefaultDataType<T>::value>
+class Param
+{
+    static_assert(MessageID < CANAS_MSG_ID_COUNT, "Invalid Message ID");
+    static_assert(std::is_same<typename DataType<TypeID>::ValueType, T>::value,
+                  "C++ type does not match the data type");
+    static_assert(isTypeAllowed<MessageID>(TypeID), "Data type is not allowed for this Message ID");
+
+public:
+    typedef T ValueType;
+    static constexpr uint16_t message_id = MessageID;
+    static constexpr uint8_t type_id = TypeID;
+
+    static CanasMessageData encode(const T& value)
+    {
+        CanasMessageData data;
+        data.type = TypeID;
+        data.length = 0;
+        DataType<TypeID>::set(data.container, value);
+        return data;
+    }
+
+    /**
+     * @return False if the data type is wrong; the value is left untouched then.
+     */
+    static bool decode(const CanasMessageData& data, T& out_value)
+    {
+        if (data.type != TypeID)
+            return false;
+        out_value = DataType<TypeID>::get(data.container);
+        return true;
+    }
+
+    static int subscribe(CanasInstance* pi, uint8_t redund_chan_count)
+    {
+        return canasParamSubscribe(pi, MessageID, redund_chan_count, NULL, NULL);
+    }
+
+    static int unsubscribe(CanasInstance* pi) { return canasParamUnsubscribe(pi, MessageID); }
+
+    static int advertise(CanasInstance* pi, bool interlaced = false)
+    {
+        return canasParamAdvertise(pi, MessageID, interlaced);
+    }
+
+    static int unadvertise(CanasInstance* pi) { return canasParamUnadvertise(pi, MessageID); }
+
+    static int publish(CanasInstance* pi, const T& value, uint8_t service_code = 0)
+    {
+        const CanasMessageData data = encode(value);
+        return canasParamPublish(pi, MessageID, &data, service_code);
+    }
+
+    /**
+     * @return @ref CanasErrorCode; -CANAS_ERR_BAD_DATA_TYPE if the received value has different type
+     */
+    static int read(CanasInstance* pi, uint8_t redund_chan, T& out_value, uint64_t* ptimestamp_usec = NULL)
+    {
+        CanasParamCallbackArgs args;
+        const int res = canasParamRead(pi, MessageID, redund_chan, &args);
+        if (res != 0)
+            return res;
+        if (!decode(args.message.data, out_value))
+            return -CANAS_ERR_BAD_DATA_TYPE;
+        if (ptimestamp_usec != NULL)
+            *ptimestamp_usec = args.timestamp_usec;
+        return 0;
+    }
+};
+
+/**
+ * Publication through the handle, without lookups.
+ */
+template <typename P>
+class Publisher
+{
+    CanasParamHandle handle_;
+
+public:
+    Publisher() : handle_(NULL) { }
+
+    int advertise(CanasInstance* pi, bool interlaced = false)
+    {
+        return canasParamAdvertiseHandle(pi, P::message_id, interlaced, &handle_);
+    }
+
+    int unadvertise(CanasInstance* pi)
+    {
+        handle_ = NULL;
+        return canasParamUnadvertise(pi, P::message_id);
+    }
+
+    int publish(CanasInstance* pi, const typename P::ValueType& value, uint8_t service_code = 0)
+    {
+        const CanasMessageData data = P::encode(value);
+        return canasParamPublishHandle(pi, handle_, &data, service_code);
+    }
+};
+
+/**
+ * Typed subscription. The callback can be any callable, e.g. a lambda; it is stored by value, nothing is allocated.
+ * It is invoked as callback(const ValueType& value, const CanasParamCallbackRefArgs& args).
+ * Messages of a wrong data type are counted and dropped.
+ * The object must not be moved or destroyed while subscribed.
+ */
+template <typename P, typename Callback>
+class Subscriber
+{
+    Callback callback_;
+    uint32_t type_errors_;
+
+    static void handle(CanasInstance*, const CanasParamCallbackRefArgs* pargs)
+    {
+        Subscriber* const self = static_cast<Subscriber*>(pargs->parg);
+        typename P::ValueType value;
+        if (P::decode(pargs->pentry->message.data, value))
+            self->callback_(value, *pargs);
+        else
+            self->type_errors_++;
+    }
+
+public:
+    explicit Subscriber(const Callback& callback) : callback_(callback), type_errors_(0) { }
+
+    int subscribe(CanasInstance* pi, uint8_t redund_chan_count)
+    {
+        return canasParamSubscribeRef(pi, P::message_id, redund_chan_count, &Subscriber::handle, this);
+    }
+
+    int unsubscribe(CanasInstance* pi) { return canasParamUnsubscribe(pi, P::message_id); }
+
+    uint32_t getTypeErrorCount() const { return type_errors_; }
+};
+
+template <typename P, typename Callback>
+Subscriber<P, Callback> makeSubscriber(const Callback& callback)
+{
+    return Subscriber<P, Callback>(callback);
+}
+
+}
+
+#endif
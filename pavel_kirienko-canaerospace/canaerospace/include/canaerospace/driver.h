@@ -35,12 +35,15 @@ static const uint32_t CANAS_CAN_FLAG_RTR = (1 << 30);  ///< Remote transmission
 
 /**
  * CAN frame
+ * The reception timestamp must come from the same time base as @ref CanasTimestampFn. It is used by
+ * canasUpdate() and canasUpdateBatch(), whereas canasUpdateAt() takes the time from its argument instead.
  */
 typedef struct
 {
+    uint64_t timestamp_usec; ///< Reception time provided by the driver, zero if unknown. Ignored on transmission.
     uint8_t data[8];
-    uint32_t id;      ///< Full ID (Standard + Extended) and flags (CANAS_CAN_FLAG_*)
-    uint8_t dlc;      ///< Data length code
+    uint32_t id;             ///< Full ID (Standard + Extended) and flags (CANAS_CAN_FLAG_*)
+    uint8_t dlc;             ///< Data length code
 } CanasCanFrame;
 
 /**
@@ -0,0 +1,553 @@
+/*
+ * Data types of the standard parameters for the typed C++ interface
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+/*
+ * Generated by tools/gen_param_registry.py from nod_default.h, uav.h. Do not edit.
+ */
+
+#ifndef CANAEROSPACE_PARAM_ID_PARAM_BINDINGS_HPP_
+#define CANAEROSPACE_PARAM_ID_PARAM_BINDINGS_HPP_
+
+#include "../canaerospace.hpp"
+#include "nod_default.h"
+#include "uav.h"
+
+#define T(x) CANAS_PARAM_TYPE_BIT(CANAS_DATATYPE_##x)
+
+namespace canaerospace
+{
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_ESC_COMMAND_1, T(USHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_ESC_COMMAND_2, T(USHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_ESC_COMMAND_3, T(USHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_ESC_COMMAND_4, T(USHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_ESC_COMMAND_5, T(USHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_ESC_COMMAND_6, T(USHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_ESC_COMMAND_7, T(USHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_ESC_COMMAND_8, T(USHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_BODY_LONGITUDINAL_ACCELERATION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_BODY_LATERAL_ACCELERATION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_BODY_NORMAL_ACCELERATION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_BODY_PITCH_RATE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_BODY_ROLL_RATE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_BODY_YAW_RATE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_RUDDER_POSITION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_STABILIZER_POSITION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ELEVATOR_POSITION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_LEFT_AILERON_POSITION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_RIGHT_AILERON_POSITION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_BODY_PITCH_ANGLE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_BODY_ROLL_ANGLE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_BODY_SIDESLIP, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ALTITUDE_RATE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_INDICATED_AIRSPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_TRUE_AIRSPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_CALIBRATED_AIRSPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_MACH_NUMBER, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_BARO_CORRECTION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_BARO_CORRECTED_ALTITUDE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HEADING_ANGLE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_STANDARD_ALTITUDE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_TOTAL_AIR_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_STATIC_AIR_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DIFFERENTIAL_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_STATIC_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HEADING_RATE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_PORT_SIDE_ANGLE_OF_ATTACK, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_STARBORD_SIDE_ANGLE_OF_ATTACK, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DENSITY_ALTITUDE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_TURN_COORDINATION_RATE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_TRUE_ALTITUDE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_WIND_SPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_WIND_DIRECTION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_OUTSIDE_AIR_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_BODY_NORMAL_VELOCITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_BODY_LONGITUDINAL_VELOCITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_BODY_LATERAL_VELOCITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_TOTAL_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_PITCH_CONTROL_POSITION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ROLL_CONTROL_POSITION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_LATERAL_STICK_TRIM_POSITION_COMMAND, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_YAW_CONTROL_POSITION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_COLLECTIVE_CONTROL_POSITION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_LONGITUDINAL_STICK_TRIM_POSITION_COMMAND, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DIRECTIONAL_PEDALS_TRIM_POSITION_COMMAND, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_COLLECTIVE_LEVER_TRIM_POSITION_COMMAND, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_CYCLIC_CONTROL_STICK_SWITCHES, T(BLONG) | T(BSHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_LATERAL_TRIM_SPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_LONGITUDINAL_TRIM_SPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_PEDAL_TRIM_SPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_COLLECTIVE_TRIM_SPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NOSE_WHEEL_STEERING_HANDLE_POSITION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_THROTTLE_LEVER_POSITION_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_THROTTLE_LEVER_POSITION_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_THROTTLE_LEVER_POSITION_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_THROTTLE_LEVER_POSITION_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_CONDITION_LEVER_POSITION_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_CONDITION_LEVER_POSITION_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_CONDITION_LEVER_POSITION_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_CONDITION_LEVER_POSITION_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_THROTTLE_LEVER_POSITION_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_THROTTLE_LEVER_POSITION_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_THROTTLE_LEVER_POSITION_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_THROTTLE_LEVER_POSITION_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_CONDITION_LEVER_POSITION_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_CONDITION_LEVER_POSITION_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_CONDITION_LEVER_POSITION_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_CONDITION_LEVER_POSITION_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FLAPS_LEVER_POSITION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_SLATS_LEVER_POSITION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_PARK_BRAKE_LEVER_POSITION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_SPEEDBRAKE_LEVER_POSITION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_THROTTLE_MAX_LEVER_POSITION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_PILOT_LEFT_BRAKE_PEDAL_POSITION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_PILOT_RIGHT_BRAKE_PEDAL_POSITION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_COPILOT_LEFT_BRAKE_PEDAL_POSITION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_COPILOT_RIGHT_BRAKE_PEDAL_POSITION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_TRIM_SYSTEM_SWITCHES, T(BLONG) | T(BSHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_TRIM_SYSTEM_LIGHTS, T(BLONG) | T(BSHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_COLLECTIVE_CONTROL_STICK_SWITCHES, T(BLONG) | T(BSHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_STICK_SHAKER_STALL_WARNING_DEVICE, T(BLONG) | T(BSHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_N1_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_N1_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_N1_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_N1_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_N2_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_N2_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_N2_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_N2_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_TORQUE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_TORQUE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_TORQUE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_TORQUE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_TURBINE_INLET_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_TURBINE_INLET_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_TURBINE_INLET_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_TURBINE_INLET_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_INTER_TURBINE_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_INTER_TURBINE_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_INTER_TURBINE_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_INTER_TURBINE_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_TURBINE_OUTLET_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_TURBINE_OUTLET_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_TURBINE_OUTLET_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_TURBINE_OUTLET_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_FUEL_FLOW_RATE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_FUEL_FLOW_RATE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_FUEL_FLOW_RATE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_FUEL_FLOW_RATE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_MANIFOLD_PRESSURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_MANIFOLD_PRESSURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_MANIFOLD_PRESSURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_MANIFOLD_PRESSURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_OIL_PRESSURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_OIL_PRESSURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_OIL_PRESSURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_OIL_PRESSURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_OIL_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_OIL_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_OIL_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_OIL_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_CYLINDER_HEAD_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_CYLINDER_HEAD_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_CYLINDER_HEAD_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_CYLINDER_HEAD_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_OIL_QUANTITY_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_OIL_QUANTITY_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_OIL_QUANTITY_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_OIL_QUANTITY_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_COOLAND_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_COOLAND_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_COOLAND_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_COOLAND_TEMPERATURE_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_POWER_RATING_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_POWER_RATING_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_POWER_RATING_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_POWER_RATING_ECS_CHANNEL_A, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_STATUS_1_ECS_CHANNEL_A, T(BSHORT) | T(BLONG))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_STATUS_1_ECS_CHANNEL_A, T(BSHORT) | T(BLONG))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_STATUS_1_ECS_CHANNEL_A, T(BSHORT) | T(BLONG))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_STATUS_1_ECS_CHANNEL_A, T(BSHORT) | T(BLONG))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_STATUS_2_ECS_CHANNEL_A, T(BSHORT) | T(BLONG))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_STATUS_2_ECS_CHANNEL_A, T(BSHORT) | T(BLONG))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_STATUS_2_ECS_CHANNEL_A, T(BSHORT) | T(BLONG))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_STATUS_2_ECS_CHANNEL_A, T(BSHORT) | T(BLONG))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_N1_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_N1_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_N1_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_N1_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_N2_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_N2_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_N2_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_N2_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_TORQUE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_TORQUE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_TORQUE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_TORQUE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_TURBINE_INLET_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_TURBINE_INLET_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_TURBINE_INLET_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_TURBINE_INLET_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_INTER_TURBINE_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_INTER_TURBINE_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_INTER_TURBINE_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_INTER_TURBINE_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_TURBINE_OUTLET_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_TURBINE_OUTLET_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_TURBINE_OUTLET_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_TURBINE_OUTLET_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_FUEL_FLOW_RATE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_FUEL_FLOW_RATE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_FUEL_FLOW_RATE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_FUEL_FLOW_RATE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_MANIFOLD_PRESSURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_MANIFOLD_PRESSURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_MANIFOLD_PRESSURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_MANIFOLD_PRESSURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_OIL_PRESSURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_OIL_PRESSURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_OIL_PRESSURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_OIL_PRESSURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_OIL_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_OIL_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_OIL_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_OIL_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_CYLINDER_HEAD_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_CYLINDER_HEAD_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_CYLINDER_HEAD_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_CYLINDER_HEAD_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_OIL_QUANTITY_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_OIL_QUANTITY_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_OIL_QUANTITY_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_OIL_QUANTITY_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_COOLANT_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_COOLANT_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_COOLANT_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_COOLANT_TEMPERATURE_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_POWER_RATING_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_POWER_RATING_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_POWER_RATING_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_POWER_RATING_ECS_CHANNEL_B, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_STATUS_1_ECS_CHANNEL_B, T(BSHORT) | T(BLONG))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_STATUS_1_ECS_CHANNEL_B, T(BSHORT) | T(BLONG))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_STATUS_1_ECS_CHANNEL_B, T(BSHORT) | T(BLONG))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_STATUS_1_ECS_CHANNEL_B, T(BSHORT) | T(BLONG))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_1_STATUS_2_ECS_CHANNEL_B, T(BSHORT) | T(BLONG))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_2_STATUS_2_ECS_CHANNEL_B, T(BSHORT) | T(BLONG))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_3_STATUS_2_ECS_CHANNEL_B, T(BSHORT) | T(BLONG))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ENGINE_4_STATUS_2_ECS_CHANNEL_B, T(BSHORT) | T(BLONG))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_PUMP_1_FLOW_RATE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_PUMP_2_FLOW_RATE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_PUMP_3_FLOW_RATE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_PUMP_4_FLOW_RATE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_PUMP_5_FLOW_RATE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_PUMP_6_FLOW_RATE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_PUMP_7_FLOW_RATE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_PUMP_8_FLOW_RATE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_TANK_1_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_TANK_2_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_TANK_3_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_TANK_4_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_TANK_5_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_TANK_6_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_TANK_7_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_TANK_8_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_TANK_1_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_TANK_2_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_TANK_3_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_TANK_4_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_TANK_5_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_TANK_6_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_TANK_7_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_TANK_8_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_SYSTEM_1_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_SYSTEM_2_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_SYSTEM_3_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_SYSTEM_4_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_SYSTEM_5_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_SYSTEM_6_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_SYSTEM_7_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FUEL_SYSTEM_8_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ROTOR_1_RPM, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ROTOR_2_RPM, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ROTOR_3_RPM, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ROTOR_4_RPM, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_1_SPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_2_SPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_3_SPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_4_SPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_5_SPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_6_SPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_7_SPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_8_SPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_1_OIL_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_2_OIL_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_3_OIL_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_4_OIL_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_5_OIL_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_6_OIL_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_7_OIL_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_8_OIL_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_1_OIL_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_2_OIL_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_3_OIL_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_4_OIL_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_5_OIL_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_6_OIL_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_7_OIL_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_8_OIL_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_1_OIL_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_2_OIL_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_3_OIL_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_4_OIL_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_5_OIL_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_6_OIL_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_7_OIL_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEARBOX_8_OIL_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_1_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_2_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_3_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_4_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_5_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_6_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_7_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_8_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_1_FLUID_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_2_FLUID_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_3_FLUID_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_4_FLUID_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_5_FLUID_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_6_FLUID_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_7_FLUID_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_8_FLUID_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_1_FLUID_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_2_FLUID_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_3_FLUID_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_4_FLUID_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_5_FLUID_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_6_FLUID_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_7_FLUID_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_HYDRAULIC_SYSTEM_8_FLUID_QUANTITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AC_SYSTEM_1_VOLTAGE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AC_SYSTEM_2_VOLTAGE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AC_SYSTEM_3_VOLTAGE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AC_SYSTEM_4_VOLTAGE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AC_SYSTEM_5_VOLTAGE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AC_SYSTEM_6_VOLTAGE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AC_SYSTEM_7_VOLTAGE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AC_SYSTEM_8_VOLTAGE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AC_SYSTEM_9_VOLTAGE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AC_SYSTEM_10_VOLTAGE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AC_SYSTEM_1_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AC_SYSTEM_2_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AC_SYSTEM_3_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AC_SYSTEM_4_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AC_SYSTEM_5_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AC_SYSTEM_6_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AC_SYSTEM_7_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AC_SYSTEM_8_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AC_SYSTEM_9_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AC_SYSTEM_10_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DC_SYSTEM_1_VOLTAGE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DC_SYSTEM_2_VOLTAGE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DC_SYSTEM_3_VOLTAGE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DC_SYSTEM_4_VOLTAGE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DC_SYSTEM_5_VOLTAGE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DC_SYSTEM_6_VOLTAGE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DC_SYSTEM_7_VOLTAGE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DC_SYSTEM_8_VOLTAGE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DC_SYSTEM_9_VOLTAGE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DC_SYSTEM_10_VOLTAGE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DC_SYSTEM_1_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DC_SYSTEM_2_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DC_SYSTEM_3_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DC_SYSTEM_4_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DC_SYSTEM_5_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DC_SYSTEM_6_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DC_SYSTEM_7_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DC_SYSTEM_8_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DC_SYSTEM_9_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DC_SYSTEM_10_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_PROP_1_ICEGUARD_DC_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_PROP_2_ICEGUARD_DC_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_PROP_3_ICEGUARD_DC_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_PROP_4_ICEGUARD_DC_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_PROP_5_ICEGUARD_DC_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_PROP_6_ICEGUARD_DC_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_PROP_7_ICEGUARD_DC_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_PROP_8_ICEGUARD_DC_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_PROP_9_ICEGUARD_DC_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_PROP_10_ICEGUARD_DC_CURRENT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ACTIVE_NAV_SYSTEM_WAYPOINT_LATITUDE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ACTIVE_NAV_SYSTEM_WAYPOINT_LONGITUDE, T(FLOAT) | T(SHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ACTIVE_NAV_SYSTEM_WAYPOINT_HEIGHT_ABOVE_ELLIPSOID, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ACTIVE_NAV_SYSTEM_WAYPOINT_ALTITUDE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ACTIVE_NAV_SYSTEM_GROUND_SPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ACTIVE_NAV_SYSTEM_TRUE_TRACK, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ACTIVE_NAV_SYSTEM_MAGNETIC_TRACK, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ACTIVE_NAV_SYSTEM_CROSS_TRACK_ERROR, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ACTIVE_NAV_SYSTEM_TRACK_ERROR_ANGLE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ACTIVE_NAV_SYSTEM_TIME_TO_GO, T(SHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ACTIVE_NAV_SYSTEM_ESTIMATED_TIME_OF_ARRIVAL, T(SHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ACTIVE_NAV_SYSTEM_ESTIMATED_ENROUTE_TIME, T(SHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_IDENTIFIER_0_3, T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_IDENTIFIER_4_7, T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_IDENTIFIER_8_11, T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_IDENTIFIER_12_15, T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_TYPE_IDENTIFIER, T(LONG) | T(SHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_LATITUDE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_LONGITUDE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_MINIMUM_ALTITUDE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_MINIMUM_FLIGHT_LEVEL, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_MINIMUM_RADAR_HEIGHT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_MINIMUM_HEIGHT_ABOVE_ELLIPSOID, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_MAXIMUM_ALTITUDE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_MAXIMUM_FLIGHT_LEVEL, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_MAXIMUM_RADAR_HEIGHT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_MAXIMUM_HEIGHT_ABOVE_ELLIPSOID, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_PLANNED_ALTITUDE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_PLANNED_FLIGHT_LEVEL, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_PLANNED_RADAR_HEIGHT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_PLANNED_HEIGHT_ABOVE_ELLIPSOID, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DISTANCE_TO_NAV_WAYPOINT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_TIME_TO_GO_TO_NAV_WAYPOINT, T(SHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_ESTIMATED_TIME_OF_ARRIVAL, T(SHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_ESTIMATED_ENROUTE_TIME, T(SHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_NAV_WAYPOINT_STATUS_INFORMATION, T(BLONG) | T(BSHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GPS_AIRCRAFT_LATITUDE, T(DOUBLEL) | T(DOUBLEH) | T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GPS_AIRCRAFT_LONGITUDE, T(DOUBLEL) | T(DOUBLEH) | T(FLOAT) | T(SHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GPS_AIRCRAFT_HEIGHT_ABOVE_ELLIPSOID, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GPS_GROUND_SPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GPS_TRUE_TRACK, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GPS_MAGNETIC_TRACK, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GPS_CROSS_TRACK_ERROR, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GPS_TRACK_ERROR_ANGLE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GPS_GLIDESLOPE_DEVIATION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GPS_PREDICTED_RAIM, T(ULONG) | T(USHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GPS_VERTICAL_FIGURE_OF_MERIT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GPS_HORIZONTAL_FIGURE_OF_MERIT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GPS_MODE_OF_OPERATION, T(SHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_INS_AIRCRAFT_LATITUDE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_INS_AIRCRAFT_LONGITUDE, T(FLOAT) | T(SHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_INS_AIRCRAFT_HEIGHT_ABOVE_ELLIPSOID, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_INS_AIRCRAFT_GROUND_SPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_INS_AIRCRAFT_TRUE_TRACK, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_INS_AIRCRAFT_MAGNETIC_TRACK, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_INS_AIRCRAFT_CROSS_TRACK_ERROR, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_INS_AIRCRAFT_TRACK_ERROR_ANGLE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_INS_VERTICAL_FIGURE_OF_MERIT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_INS_HORIZONTAL_FIGURE_OF_MERIT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AUXILIARY_NAV_SYSTEM_AIRCRAFT_LATITUDE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AUXILIARY_NAV_SYSTEM_AIRCRAFT_LONGITUDE, T(FLOAT) | T(SHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AUXILIARY_NAV_SYSTEM_AIRCRAFT_HEIGHT_ABOVE_ELLIPSOID, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AUXILIARY_NAV_SYSTEM_AIRCRAFT_GROUND_SPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AUXILIARY_NAV_SYSTEM_AIRCRAFT_TRUE_TRACK, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AUXILIARY_NAV_SYSTEM_AIRCRAFT_MAGNETIC_TRACK, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AUXILIARY_NAV_SYSTEM_AIRCRAFT_CROSS_TRACK_ERROR, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AUXILIARY_NAV_SYSTEM_AIRCRAFT_TRACK_ERROR_ANGLE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AUXILIARY_NAV_SYSTEM_VERTICAL_FIGURE_OF_MERIT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_AUXILIARY_NAV_SYSTEM_HORIZONTAL_FIGURE_OF_MERIT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_MAGNETIC_HEADING, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_RADIO_HEIGHT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DME_1_DISTANCE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DME_2_DISTANCE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DME_3_DISTANCE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DME_4_DISTANCE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DME_1_TIME_TO_GO, T(SHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DME_2_TIME_TO_GO, T(SHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DME_3_TIME_TO_GO, T(SHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DME_4_TIME_TO_GO, T(SHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DME_1_GROUND_SPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DME_2_GROUND_SPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DME_3_GROUND_SPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DME_4_GROUND_SPEED, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ADF_1_BEARING, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ADF_2_BEARING, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ADF_3_BEARING, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ADF_4_BEARING, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ILS_1_LOCALIZE_DEVIATION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ILS_2_LOCALIZE_DEVIATION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ILS_3_LOCALIZE_DEVIATION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ILS_4_LOCALIZE_DEVIATION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ILS_1_GLIDESLOPE_DEVIATION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ILS_2_GLIDESLOPE_DEVIATION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ILS_3_GLIDESLOPE_DEVIATION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ILS_4_GLIDESLOPE_DEVIATION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FLIGHT_DIRECTOR_1_PITCH_DEVIATION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FLIGHT_DIRECTOR_2_PITCH_DEVIATION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FLIGHT_DIRECTOR_1_ROLL_DEVIATION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_FLIGHT_DIRECTOR_2_ROLL_DEVIATION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DECISION_HEIGHT, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_VHF_1_COM_FREQUENCY, T(FLOAT) | T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_VHF_2_COM_FREQUENCY, T(FLOAT) | T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_VHF_3_COM_FREQUENCY, T(FLOAT) | T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_VHF_4_COM_FREQUENCY, T(FLOAT) | T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_VOR_ILS_1_FREQUENCY, T(FLOAT) | T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_VOR_ILS_2_FREQUENCY, T(FLOAT) | T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_VOR_ILS_3_FREQUENCY, T(FLOAT) | T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_VOR_ILS_4_FREQUENCY, T(FLOAT) | T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ADF_1_FREQUENCY, T(FLOAT) | T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ADF_2_FREQUENCY, T(FLOAT) | T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ADF_3_FREQUENCY, T(FLOAT) | T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_ADF_4_FREQUENCY, T(FLOAT) | T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DME_1_CHANNEL, T(FLOAT) | T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DME_2_CHANNEL, T(FLOAT) | T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DME_3_CHANNEL, T(FLOAT) | T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DME_4_CHANNEL, T(FLOAT) | T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_TRANSPONDER_1_CODE, T(FLOAT) | T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_TRANSPONDER_2_CODE, T(FLOAT) | T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_TRANSPONDER_3_CODE, T(FLOAT) | T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_TRANSPONDER_4_CODE, T(FLOAT) | T(ACHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DESIRED_TRACK_ANGLE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_MAGNETIC_VARIATION, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_SELECTED_GLIDEPATH_ANGLE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_SELECTED_RUNWAY_HEADING, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_COMPUTED_VERTICAL_VELOCITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_SELECTED_COURSE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_VOR_1_RADIAL, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_VOR_2_RADIAL, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_VOR_3_RADIAL, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_VOR_4_RADIAL, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_TRUE_EAST_VELOCITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_TRUE_NORTH_VELOCITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_TRUE_UP_VELOCITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_TRUE_HEADING, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEAR_LEVER_SWITCHES, T(BLONG) | T(BSHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_GEAR_LEVER_LIGHTS_WOW_SOLENOID, T(BLONG) | T(BSHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_LANDING_GEAR_1_TIRE_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_LANDING_GEAR_2_TIRE_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_LANDING_GEAR_3_TIRE_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_LANDING_GEAR_4_TIRE_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_LANDING_GEAR_1_BRAKE_PAD_THICKNESS, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_LANDING_GEAR_2_BRAKE_PAD_THICKNESS, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_LANDING_GEAR_3_BRAKE_PAD_THICKNESS, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_LANDING_GEAR_4_BRAKE_PAD_THICKNESS, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_UTC, T(CHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_CABIN_PRESSURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_CABIN_ALTITUDE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_CABIN_TEMPERATURE, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_LONGITUDINAL_CENTER_OF_GRAVITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_LATERAL_CENTER_OF_GRAVITY, T(FLOAT) | T(SHORT2))
+CANAS_CPP_PARAM_BINDING(CANAS_NOD_DEF_DATE, T(CHAR4))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_ROTOR_RPM_1, T(USHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_ROTOR_RPM_2, T(USHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_ROTOR_RPM_3, T(USHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_ROTOR_RPM_4, T(USHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_ROTOR_RPM_5, T(USHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_ROTOR_RPM_6, T(USHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_ROTOR_RPM_7, T(USHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_ROTOR_RPM_8, T(USHORT))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_GIMBAL_ROLL, T(FLOAT))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_GIMBAL_ROLL_RATE, T(FLOAT))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_GIMBAL_PITCH, T(FLOAT))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_GIMBAL_PITCH_RATE, T(FLOAT))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_GIMBAL_YAW, T(FLOAT))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_GIMBAL_YAW_RATE, T(FLOAT))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_GRIPPER_GRIP_COMMAND, T(CHAR))
+CANAS_CPP_PARAM_BINDING(CANAS_UAV_GRIPPER_GRIP_STATE, T(CHAR))
+}
+
+#undef T
+
+#endif
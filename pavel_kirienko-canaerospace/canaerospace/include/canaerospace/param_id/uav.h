@@ -20,7 +20,7 @@ typedef enum
     /**
      * ESC control
      * Type: USHORT
-     * Units: ESC thrust normalized into 1..65535; 0 - disarm
+     * Values: ESC thrust normalized into 1..65535; 0 - disarm
      */
     CANAS_UAV_ESC_COMMAND_1 = 200,
     CANAS_UAV_ESC_COMMAND_2,
@@ -51,14 +51,13 @@ typedef enum
     /**
      * Gimbal angle or angular rate, respectively
      * Type: FLOAT
-     * Units: deg or deg/sec, respectively
      */
-    CANAS_UAV_GIMBAL_ROLL = 1810,
-    CANAS_UAV_GIMBAL_ROLL_RATE,
-    CANAS_UAV_GIMBAL_PITCH,
-    CANAS_UAV_GIMBAL_PITCH_RATE,
-    CANAS_UAV_GIMBAL_YAW,
-    CANAS_UAV_GIMBAL_YAW_RATE,
+    CANAS_UAV_GIMBAL_ROLL = 1810,          ///< Units: deg
+    CANAS_UAV_GIMBAL_ROLL_RATE,            ///< Units: deg/s
+    CANAS_UAV_GIMBAL_PITCH,                ///< Units: deg
+    CANAS_UAV_GIMBAL_PITCH_RATE,           ///< Units: deg/s
+    CANAS_UAV_GIMBAL_YAW,                  ///< Units: deg
+    CANAS_UAV_GIMBAL_YAW_RATE,             ///< Units: deg/s
 
     /**
      * Gripper control
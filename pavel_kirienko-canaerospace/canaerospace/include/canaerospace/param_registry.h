@@ -0,0 +1,79 @@
+/*
+ * Parameter metadata registry
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#ifndef CANAEROSPACE_PARAM_REGISTRY_H_
+#define CANAEROSPACE_PARAM_REGISTRY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "message.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Bit of the given standard data type in @ref CanasParamMeta.type_mask.
+ * User-defined data types have no bits, so they are never accepted for the registered parameters.
+ */
+#define CANAS_PARAM_TYPE_BIT(datatype) (1ul << (datatype))
+
+/**
+ * Buffer size required for @ref canasDumpParam()
+ */
+#define CANAS_DUMP_PARAM_BUF_LEN 96
+
+typedef struct
+{
+    uint16_t message_id;
+    uint16_t nominal_rate_hz;       ///< Zero if not specified
+    uint32_t type_mask;             ///< @ref CANAS_PARAM_TYPE_BIT() of every data type allowed for this parameter
+    const char* name;               ///< Identifier without the common prefix, e.g. "BODY_PITCH_RATE"
+    const char* units;              ///< Empty string if the parameter has no units
+} CanasParamMeta;
+
+/**
+ * Read-only table that can be placed in ROM.
+ */
+typedef struct
+{
+    const CanasParamMeta* pentries; ///< Sorted by Message ID
+    uint16_t num_entries;
+} CanasParamRegistry;
+
+/**
+ * Registry of the default identifier distribution (param_id/nod_default.h) and the UAV extension (param_id/uav.h).
+ * It is generated from these headers by tools/gen_param_registry.py.
+ */
+extern const CanasParamRegistry canas_param_registry_default;
+
+/**
+ * Find the metadata of the parameter.
+ * @param [in] preg   Registry
+ * @param [in] msg_id Message ID
+ * @return            Pointer to the entry or NULL if the parameter is not registered.
+ */
+const CanasParamMeta* canasParamMetaFind(const CanasParamRegistry* preg, uint16_t msg_id);
+
+/**
+ * @return True if the data type is allowed for the parameter.
+ */
+bool canasParamMetaTypeAllowed(const CanasParamMeta* pmeta, uint8_t datatype);
+
+/**
+ * Print the parameter value for humans, e.g. "303 BODY_PITCH_RATE = 2.5 deg/s".
+ * Value is printed according to its actual data type; a data type not allowed by the registry is marked as such.
+ * @param [in]  preg   Registry, may be NULL
+ * @param [in]  msg_id Message ID
+ * @param [in]  pdata  Message data
+ * @param [out] pbuf   Pointer to output string buffer of size @ref CANAS_DUMP_PARAM_BUF_LEN
+ * @return             pbuf
+ */
+char* canasDumpParam(const CanasParamRegistry* preg, uint16_t msg_id, const CanasMessageData* pdata, char* pbuf);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,89 @@
+/*
+ * Size-class pool allocator
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#ifndef CANAEROSPACE_POOL_H_
+#define CANAEROSPACE_POOL_H_
+
+#include "canaerospace.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Block sizes grow in steps of 1.5x and 1.33x alternately: 16, 24, 32, 48, 64, 96, ... 8192 bytes.
+ */
+#define CANAS_POOL_CLASS_COUNT 19
+
+/**
+ * Every block is preceded by a header of this size; it also defines the alignment of the returned pointers.
+ */
+#define CANAS_POOL_ALIGNMENT 8
+
+typedef struct
+{
+    uint32_t blocks_in_use;
+    uint32_t blocks_peak;           ///< High-water mark of blocks_in_use
+    uint32_t blocks_total;          ///< Blocks ever taken from the buffer for this class, including the free ones
+} CanasPoolClassStats;
+
+/**
+ * Blocks are carved from the buffer on demand; freed blocks are kept in the list of their size class for reuse.
+ * Memory of one class is never given to another one, so the buffer must be large enough for the peak usage of
+ * every class at once - the high-water marks show how much was really needed.
+ * The pool is not thread safe.
+ */
+typedef struct
+{
+    uint8_t* pbuf_next;             ///< Beginning of the untouched part of the buffer
+    uint8_t* pbuf_end;
+    void* free_lists[CANAS_POOL_CLASS_COUNT];
+    CanasPoolClassStats classes[CANAS_POOL_CLASS_COUNT];
+
+    uint32_t buf_size;              ///< Usable size of the buffer after alignment
+    uint32_t buf_used;              ///< High-water mark of the buffer usage
+    uint32_t bytes_in_use;          ///< Sum of the block sizes currently allocated, including the headers
+    uint32_t bytes_peak;            ///< High-water mark of bytes_in_use
+    uint32_t failures;              ///< Number of the allocation requests that could not be satisfied
+} CanasPool;
+
+/**
+ * Initialize the pool.
+ * @param [out] ppool Pool to be initialized
+ * @param [in]  pbuf  Memory for the pool, e.g. a static array; does not need to be aligned
+ * @param [in]  size  Size of the memory in bytes
+ * @return            @ref CanasErrorCode
+ */
+int canasPoolInit(CanasPool* ppool, void* pbuf, uint32_t size);
+
+/**
+ * Allocate a block in constant time.
+ * @param [in] ppool Pool pointer
+ * @param [in] size  Number of bytes, up to 8192 minus header
+ * @return           Pointer aligned to @ref CANAS_POOL_ALIGNMENT, or NULL if no memory available
+ */
+void* canasPoolAlloc(CanasPool* ppool, int size);
+
+/**
+ * Return the block to the pool in constant time.
+ * @param [in] ppool Pool pointer
+ * @param [in] ptr   Pointer returned by @ref canasPoolAlloc(), or NULL
+ */
+void canasPoolFree(CanasPool* ppool, void* ptr);
+
+/**
+ * Ready to use @ref CanasMallocFn and @ref CanasFreeFn. The pool must be set to @ref CanasConfig.pmem_state.
+ * @{
+ */
+void* canasPoolMallocFn(CanasInstance* pi, int size);
+void canasPoolFreeFn(CanasInstance* pi, void* ptr);
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,73 @@
+/*
+ * Helpers for the subscriptions and advertisements known at build time
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#ifndef CANAEROSPACE_STATIC_TABLE_H_
+#define CANAEROSPACE_STATIC_TABLE_H_
+
+#include <stddef.h>
+#include "canaerospace.h"
+
+/**
+ * Defines a @ref CanasStaticTable together with its storage, from two lists of X-macros.
+ * The table goes to ROM; RAM is taken only by the subscriptions with their redundancy caches, and the advertisements.
+ *
+ * Example:
+ *   #define MY_SUBSCRIPTIONS(SUB) \
+ *       SUB(CANAS_NOD_DEF_BODY_PITCH_RATE, 2, onAngularRate, NULL) \
+ *       SUB(CANAS_NOD_DEF_BODY_ROLL_RATE,  2, onAngularRate, NULL)
+ *   #define MY_ADVERTISEMENTS(ADV) \
+ *       ADV(CANAS_UAV_ESC_COMMAND_1, false)
+ *   CANAS_STATIC_TABLE(my_table, MY_SUBSCRIPTIONS, MY_ADVERTISEMENTS)
+ *   ...
+ *   cfg.pstatic_table = &my_table;
+ *
+ * Use @ref CANAS_STATIC_NONE in place of an empty list.
+ */
+#define CANAS_STATIC_TABLE(name, SUBSCRIPTIONS, ADVERTISEMENTS) \
+    static const CanasStaticSubscription name##_subs_[] = { \
+        SUBSCRIPTIONS(CANAS_STATIC_SUB_ENTRY_) { 0, 0, NULL, NULL, NULL } \
+    }; \
+    static const CanasStaticAdvertisement name##_advs_[] = { \
+        ADVERTISEMENTS(CANAS_STATIC_ADV_ENTRY_) { 0, false } \
+    }; \
+    static uint64_t name##_sub_storage_[(0 SUBSCRIPTIONS(CANAS_STATIC_SUB_SIZE_)) / 8 + 1]; \
+    static CanasParamAdvertisement name##_adv_storage_[sizeof(name##_advs_) / sizeof(name##_advs_[0])]; \
+    static const CanasStaticTable name = { \
+        name##_subs_, name##_sub_storage_, sizeof(name##_subs_) / sizeof(name##_subs_[0]) - 1, \
+        name##_advs_, name##_adv_storage_, sizeof(name##_advs_) / sizeof(name##_advs_[0]) - 1 \
+    };
+
+/**
+ * Empty list for @ref CANAS_STATIC_TABLE
+ */
+#define CANAS_STATIC_NONE(X)
+
+#define CANAS_STATIC_SUB_ENTRY_(message_id, redund_count, callback, callback_arg) \
+    { (message_id), (redund_count), (callback), NULL, (callback_arg) },
+#define CANAS_STATIC_SUB_SIZE_(message_id, redund_count, callback, callback_arg) \
+    + CANAS_PARAM_SUBSCRIPTION_SIZE(redund_count)
+#define CANAS_STATIC_ADV_ENTRY_(message_id, interlaced) \
+    { (message_id), (interlaced) },
+
+#if defined(__cplusplus) && __cplusplus >= 201103L
+/**
+ * For C++ tables defined as constexpr arrays:
+ *   constexpr CanasStaticSubscription subs[] = { { CANAS_UAV_ESC_COMMAND_1, 1, onEsc, nullptr, nullptr } };
+ *   static uint64_t sub_storage[canasStaticStorageWords(subs)];
+ */
+constexpr unsigned canasStaticStorageWords(const CanasStaticSubscription* psubs, unsigned count)
+{
+    return (count == 0) ? 0 :
+        (CANAS_PARAM_SUBSCRIPTION_SIZE(psubs->redund_count) / 8 + canasStaticStorageWords(psubs + 1, count - 1));
+}
+
+template <unsigned N>
+constexpr unsigned canasStaticStorageWords(const CanasStaticSubscription (&subs)[N])
+{
+    return canasStaticStorageWords(subs, N);
+}
+#endif
+
+#endif
@@ -0,0 +1,99 @@
+/*
+ * Preallocated storage for subscriptions, advertisements and services
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include <string.h>
+#include "arena.h"
+#include "history.h"
+
+#define BLOCK_ALIGNMENT 8
+
+static inline int _alignBlock(int size)
+{
+    return (size + BLOCK_ALIGNMENT - 1) & ~(BLOCK_ALIGNMENT - 1);
+}
+
+/**
+ * Blocks are linked so that they will be taken in the order of their addresses.
+ */
+static uint8_t* _initRegion(CanasArenaRegion* pregion, uint8_t* pmem, int block_size, int count)
+{
+    pregion->block_size = block_size;
+    pregion->pbegin = pmem;
+    pregion->pend = pmem + block_size * count;
+    pregion->pfree = NULL;
+    for (int i = count - 1; i >= 0; i--)
+    {
+        void** pblock = (void**)(pmem + block_size * i);
+        *pblock = pregion->pfree;
+        pregion->pfree = pblock;
+    }
+    return pregion->pend;
+}
+
+int canasArenaInit(CanasInstance* pi)
+{
+    const CanasConfig* pcfg = &pi->config;
+    const int redund_count = (pcfg->max_redund_channels > 0) ? pcfg->max_redund_channels : 1;
+    const int sub_size = _alignBlock(sizeof(CanasParamSubscription) +
+        sizeof(CanasParamCacheEntry) * redund_count - sizeof(CanasParamCacheEntry));
+    const int adv_size = _alignBlock(sizeof(CanasParamAdvertisement));
+    const int srv_size = _alignBlock(sizeof(CanasServiceSubscription));
+
+    const uint8_t hist_len = pcfg->service_frame_hist_len;
+    const int hist_entries_size = sizeof(CanasServiceFrameHistoryEntry) * hist_len;
+    const int hist_size = (hist_len > 0) ? (hist_entries_size + canasHistorySlotCount(hist_len)) : 0;
+
+    const int size = sub_size * pcfg->max_param_subscriptions + adv_size * pcfg->max_param_advertisements +
+        srv_size * pcfg->max_services + hist_size;
+    if (size == 0)
+        return 0;
+
+    uint8_t* pmem = canasMalloc(pi, size);
+    if (pmem == NULL)
+        return -CANAS_ERR_NOT_ENOUGH_MEMORY;
+
+    // Regions go first, since the history hash table is not aligned
+    pmem = _initRegion(&pi->arena_param_subs, pmem, sub_size, pcfg->max_param_subscriptions);
+    pmem = _initRegion(&pi->arena_param_advs, pmem, adv_size, pcfg->max_param_advertisements);
+    pmem = _initRegion(&pi->arena_services, pmem, srv_size, pcfg->max_services);
+    if (hist_len > 0)
+    {
+        canasHistoryInit(&pi->service_history, (CanasServiceFrameHistoryEntry*)pmem, pmem + hist_entries_size,
+                         hist_len);
+    }
+    return 0;
+}
+
+void* canasArenaAlloc(CanasInstance* pi, CanasArenaRegion* pregion, int size)
+{
+    if (pregion->pfree == NULL || size > pregion->block_size)
+        return canasMalloc(pi, size);
+    void** pblock = pregion->pfree;
+    pregion->pfree = *pblock;
+    return pblock;
+}
+
+void canasArenaFree(CanasInstance* pi, CanasArenaRegion* pregion, void* ptr)
+{
+    if ((uint8_t*)ptr < pregion->pbegin || (uint8_t*)ptr >= pregion->pend)
+    {
+        canasFree(pi, ptr);
+        return;
+    }
+    void** pblock = ptr;
+    *pblock = pregion->pfree;
+    pregion->pfree = pblock;
+}
+
+void canasArenaRelease(CanasInstance* pi)
+{
+    // The subscription region goes first, so its beginning is the beginning of the block
+    if (pi->arena_param_subs.pbegin != NULL)
+        canasFree(pi, pi->arena_param_subs.pbegin);
+    memset(&pi->arena_param_subs, 0, sizeof(pi->arena_param_subs));
+    memset(&pi->arena_param_advs, 0, sizeof(pi->arena_param_advs));
+    memset(&pi->arena_services, 0, sizeof(pi->arena_services));
+    memset(&pi->service_history, 0, sizeof(pi->service_history));
+}
@@ -0,0 +1,40 @@
+/*
+ * Preallocated storage for subscriptions, advertisements and services
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#ifndef CANAEROSPACE_ARENA_H_
+#define CANAEROSPACE_ARENA_H_
+
+#include <canaerospace/canaerospace.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Allocates the service frame history and the regions requested by the capacity hints, all in one block.
+ * Nothing is allocated if nothing is needed.
+ * @return @ref CanasErrorCode
+ */
+int canasArenaInit(CanasInstance* pi);
+
+/**
+ * Takes a free block of the region if it is large enough, otherwise falls back to @ref canasMalloc().
+ */
+void* canasArenaAlloc(CanasInstance* pi, CanasArenaRegion* pregion, int size);
+
+/**
+ * Returns the block to its region, or to @ref canasFree() if it was not taken from the region.
+ */
+void canasArenaFree(CanasInstance* pi, CanasArenaRegion* pregion, void* ptr);
+
+/**
+ * Returns the block allocated by @ref canasArenaInit() to @ref canasFree(). Used when the initialization fails.
+ */
+void canasArenaRelease(CanasInstance* pi);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
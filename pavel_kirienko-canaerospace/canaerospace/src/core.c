@@ -10,19 +10,19 @@
 #include "marshal.h"
 #include "debug.h"
 #include "list.h"
+#include "index.h"
+#include "msgclass.h"
+#include "timer.h"
+#include "arena.h"
 
 static const int CANAS_DEFAULT_REPEAT_TIMEOUT_USEC = 30 * 1000 * 1000;
 
-#ifdef __GNUC__
-// RANGEINCLUSIVE() may produce a lot of these warnings
-#  pragma GCC diagnostic ignored "-Wtype-limits"
-#endif
-
 #define ALL_IFACES  -1
 
 #define REDUND_CHAN_MULT 65536ul
 
-#define RANGEINCLUSIVE(x, min, max) ((x) >= (min) && (x) <= (max))
+/// Not a valid Message ID; marks the removed static entries, so the accessors of a parameter set can detect them
+#define REMOVED_MESSAGE_ID 0xFFFF
 
 typedef enum
 {
@@ -31,29 +31,13 @@ typedef enum
     MSGGROUP_SERVICE
 } MessageGroup;
 
-static MessageGroup _detectMessageGroup(uint16_t id)
+static inline MessageGroup _detectMessageGroup(uint16_t id)
 {
-    if (RANGEINCLUSIVE(id, CANAS_MSGTYPE_EMERGENCY_EVENT_MIN, CANAS_MSGTYPE_EMERGENCY_EVENT_MAX))
+    const uint8_t cls = canasMessageClass(id);
+    if (cls == CANAS_MSGCLASS_PARAM)
         return MSGGROUP_PARAMETER;
-
-    if (RANGEINCLUSIVE(id, CANAS_MSGTYPE_NODE_SERVICE_HIGH_MIN, CANAS_MSGTYPE_NODE_SERVICE_HIGH_MAX))
+    if (cls != CANAS_MSGCLASS_WTF)
         return MSGGROUP_SERVICE;
-
-    if (RANGEINCLUSIVE(id, CANAS_MSGTYPE_USER_DEFINED_HIGH_MIN, CANAS_MSGTYPE_USER_DEFINED_HIGH_MAX))
-        return MSGGROUP_PARAMETER;
-
-    if (RANGEINCLUSIVE(id, CANAS_MSGTYPE_NORMAL_OPERATION_MIN, CANAS_MSGTYPE_NORMAL_OPERATION_MAX))
-        return MSGGROUP_PARAMETER;
-
-    if (RANGEINCLUSIVE(id, CANAS_MSGTYPE_USER_DEFINED_LOW_MIN, CANAS_MSGTYPE_USER_DEFINED_LOW_MAX))
-        return MSGGROUP_PARAMETER;
-
-    if (RANGEINCLUSIVE(id, CANAS_MSGTYPE_DEBUG_SERVICE_MIN, CANAS_MSGTYPE_DEBUG_SERVICE_MAX))
-        return MSGGROUP_PARAMETER;
-
-    if (RANGEINCLUSIVE(id, CANAS_MSGTYPE_NODE_SERVICE_LOW_MIN, CANAS_MSGTYPE_NODE_SERVICE_LOW_MAX))
-        return MSGGROUP_SERVICE;
-
     CANAS_TRACE("msggroup: failed to detect, msgid=%03x\n", (unsigned int)id);
     return MSGGROUP_WTF;
 }
@@ -101,28 +85,97 @@ static int _diffU8(uint8_t a, uint8_t b)
     return d;
 }
 
-static void _issueMessageHookCallback(CanasInstance* pi, int iface, uint16_t msg_id, CanasMessage* pmsg,
+static inline bool _hasHook(const CanasInstance* pi)
+{
+    return pi->config.fn_hook != NULL || pi->config.fn_hook_ref != NULL;
+}
+
+static void _issueMessageHookCallback(CanasInstance* pi, int iface, uint16_t msg_id, const CanasMessage* pmsg,
                                       uint8_t redund_ch, uint64_t timestamp_usec)
 {
-    if (pi->config.fn_hook == NULL)
-        return;
+    if (pi->config.fn_hook_ref != NULL)
+    {
+        CanasHookCallbackRefArgs args;
+        args.iface = (uint8_t)iface;
+        args.pmessage = pmsg;
+        args.message_id = msg_id;
+        args.redund_channel_id = redund_ch;
+        args.timestamp_usec = timestamp_usec;
 
-    CanasHookCallbackArgs args;
-    memset(&args, 0, sizeof(args));
-    args.iface = (uint8_t)iface;
-    args.message = *pmsg;
-    args.message_id = msg_id;
-    args.redund_channel_id = redund_ch;
-    args.timestamp_usec = timestamp_usec;
+        pi->config.fn_hook_ref(pi, &args);
+    }
+    if (pi->config.fn_hook != NULL)
+    {
+        CanasHookCallbackArgs args;
+        memset(&args, 0, sizeof(args));
+        args.iface = (uint8_t)iface;
+        args.message = *pmsg;
+        args.message_id = msg_id;
+        args.redund_channel_id = redund_ch;
+        args.timestamp_usec = timestamp_usec;
+
+        pi->config.fn_hook(pi, &args);
+    }
+}
+
+#if CANAEROSPACE_SEQLOCK && !defined(__GNUC__)
+#  error "CANAEROSPACE_SEQLOCK requires the GCC atomic builtins"
+#endif
+
+/**
+ * Only the thread that runs canasUpdate() writes the cache, so the sequence counter needs no read-modify-write.
+ */
+static void _writeCacheEntry(CanasParamCacheEntry* pentry, const CanasMessage* pmsg, uint64_t timestamp_usec)
+{
+#if CANAEROSPACE_SEQLOCK
+    const uint32_t seq = __atomic_load_n(&pentry->seq, __ATOMIC_RELAXED);
+    __atomic_store_n(&pentry->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);                    // Odd counter becomes visible before the data
+#endif
+    pentry->message = *pmsg;            // Save the whole message. Redundantly, but simple.
+    pentry->timestamp_usec = timestamp_usec;
+#if CANAEROSPACE_SEQLOCK
+    __atomic_store_n(&pentry->seq, seq + 2, __ATOMIC_RELEASE);
+#endif
+}
 
-    pi->config.fn_hook(pi, &args);
+int canasParamCacheCopy(const CanasParamCacheEntry* psrc, CanasParamCacheEntry* pdst)
+{
+#if CANAEROSPACE_SEQLOCK
+    for (int attempt = 0; attempt < CANAS_SEQLOCK_MAX_RETRIES; attempt++)
+    {
+        const uint32_t seq = __atomic_load_n(&psrc->seq, __ATOMIC_ACQUIRE);
+        if (seq & 1)
+            continue;                                           // Being written right now
+        pdst->message = psrc->message;
+        pdst->timestamp_usec = psrc->timestamp_usec;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);                // Data is read before the counter is checked again
+        if (__atomic_load_n(&psrc->seq, __ATOMIC_RELAXED) == seq)
+        {
+            pdst->seq = seq;
+            return 0;
+        }
+    }
+    return -CANAS_ERR_BUSY;                                     // The writer is probably preempted by the caller
+#else
+    *pdst = *psrc;
+    return 0;
+#endif
 }
 
-static void _handleReceivedParam(CanasInstance* pi, CanasParamSubscription* ppar, uint16_t msg_id, CanasMessage* pmsg,
-                                 uint8_t redund_ch, uint64_t timestamp_usec)
+static int _handleReceivedParam(CanasInstance* pi, CanasParamSubscription* ppar, uint16_t msg_id,
+                                const CanasMessage* pmsg, uint8_t redund_ch, uint64_t timestamp_usec)
 {
     if (redund_ch >= ppar->redund_count)      // We have no buffer for this redundancy channel.
-        return;                               // Sadface.
+        return 0;                             // Sadface.
+
+    // Registry mask is taken at subscription, so there is no lookup here. User-defined types have no bits.
+    if (ppar->type_mask != 0 &&
+        (pmsg->data.type >= 32 || (ppar->type_mask & CANAS_PARAM_TYPE_BIT(pmsg->data.type)) == 0))
+    {
+        CANAS_TRACE("param bad type msgid=%03x datatype=%i\n", (unsigned int)msg_id, (int)pmsg->data.type);
+        return -CANAS_ERR_BAD_DATA_TYPE;
+    }
 
     // Timestamp in redund cache is initialized to zero:
     if (ppar->redund_cache[redund_ch].timestamp_usec > 0 &&
@@ -134,12 +187,21 @@ static void _handleReceivedParam(CanasInstance* pi, CanasParamSubscription* ppar
         {
             CANAS_TRACE("param rep msgid=%03x redund=%i msgcode=%i usecago=%u\n",(unsigned int)msg_id, (int)redund_ch,
                 (int)pmsg->message_code, (unsigned int)(timestamp_usec - ppar->redund_cache[redund_ch].timestamp_usec));
-            return;                           // It's repeated message
+            return 0;                         // It's repeated message
         }
     }
-    ppar->redund_cache[redund_ch].message = *pmsg;       // Save the whole message. Redundantly, but simple.
-    ppar->redund_cache[redund_ch].timestamp_usec = timestamp_usec;
-    if (ppar->callback != NULL)
+    _writeCacheEntry(ppar->redund_cache + redund_ch, pmsg, timestamp_usec);
+    if (ppar->callback_ref != NULL)
+    {
+        CanasParamCallbackRefArgs args;
+        args.pentry = ppar->redund_cache + redund_ch;
+        args.message_id = msg_id;
+        args.parg = ppar->callback_arg;
+        args.redund_channel_id = redund_ch;
+
+        ppar->callback_ref(pi, &args);
+    }
+    else if (ppar->callback != NULL)
     {
         CanasParamCallbackArgs args;
         memset(&args, 0, sizeof(args));
@@ -151,6 +213,7 @@ static void _handleReceivedParam(CanasInstance* pi, CanasParamSubscription* ppar
 
         ppar->callback(pi, &args);
     }
+    return 0;
 }
 
 static int _parseFrame(const CanasCanFrame* pframe, uint16_t* pmsg_id, CanasMessage* pmsg, uint8_t* predund_chan)
@@ -220,60 +283,125 @@ static int _makeFrame(CanasCanFrame* pframe, uint16_t msg_id, const CanasMessage
 
 static CanasParamSubscription* _findParamSubscription(CanasInstance* pi, uint16_t id)
 {
-    CanasParamSubscription* ppar = pi->pparam_subs;
-    while (ppar)
-    {
-        if (ppar->message_id == id)
-            return ppar;
-        ppar = ppar->pnext;
-    }
-    return NULL;
+    if (id >= CANAS_MSG_ID_COUNT)
+        return NULL;
+    return canasIndexGet(pi->param_sub_index, id);
 }
 
 static CanasParamAdvertisement* _findParamAdvertisement(CanasInstance* pi, uint16_t id)
 {
-    CanasParamAdvertisement* padv = pi->pparam_advs;
-    while (padv)
-    {
-        if (padv->message_id == id)
-            return padv;
-        padv = padv->pnext;
-    }
-    return NULL;
+    if (id >= CANAS_MSG_ID_COUNT)
+        return NULL;
+    return canasIndexGet(pi->param_adv_index, id);
 }
 
 static CanasServiceSubscription* _findServiceSubscription(CanasInstance* pi, uint8_t service_code)
 {
-    CanasServiceSubscription* psrv = pi->pservice_subs;
-    while (psrv)
+    return canasIndexGet(pi->service_index, service_code);
+}
+
+static inline uint8_t _ifaceMask(const CanasInstance* pi, int iface)
+{
+    return (uint8_t)((iface < 0) ? ((1u << pi->config.iface_count) - 1) : (1u << iface));
+}
+
+static int _flushTxQueue(CanasInstance* pi)
+{
+    if (pi->tx_queue_len == 0)
+        return 0;
+
+    const uint8_t all_ifaces_mask = _ifaceMask(pi, ALL_IFACES);
+    bool same_ifaces = true;
+    for (int i = 0; i < pi->tx_queue_len; i++)
+        same_ifaces = same_ifaces && (pi->tx_queue_ifaces[i] == all_ifaces_mask);
+
+    bool delivered[CANAS_TX_QUEUE_LEN];      // Same as in _sendFrame(), one interface is enough for each frame
+    memset(delivered, 0, sizeof(delivered));
+    for (int iface = 0; iface < pi->config.iface_count; iface++)
     {
-        if (psrv->service_code == service_code)
-            return psrv;
-        psrv = psrv->pnext;
+        const CanasCanFrame* pframes = pi->tx_queue;
+        int nframes = pi->tx_queue_len;
+        CanasCanFrame selected[CANAS_TX_QUEUE_LEN];
+        uint8_t queue_index[CANAS_TX_QUEUE_LEN];
+        if (same_ifaces)
+        {
+            for (int i = 0; i < nframes; i++)
+                queue_index[i] = i;
+        }
+        else                                         // Interlaced or directed frames, this iface gets only a part
+        {
+            nframes = 0;
+            for (int i = 0; i < pi->tx_queue_len; i++)
+            {
+                if (pi->tx_queue_ifaces[i] & (1 << iface))
+                {
+                    queue_index[nframes] = i;
+                    selected[nframes++] = pi->tx_queue[i];
+                }
+            }
+            pframes = selected;
+        }
+        if (nframes == 0)
+            continue;
+
+        int num_sent = pi->config.fn_send_many(pi, iface, pframes, nframes);
+        if (num_sent != nframes)
+        {
+            CANAS_TRACE("send many failed: iface=%i nframes=%i result=%i\n", iface, nframes, num_sent);
+            num_sent = (num_sent < 0) ? 0 : ((num_sent > nframes) ? nframes : num_sent);
+        }
+        for (int i = 0; i < num_sent; i++)
+            delivered[queue_index[i]] = true;
+
+        // The driver may accept a single frame when it can't take the whole batch, e.g. when its queue is nearly full
+        for (int i = num_sent; i < nframes; i++)
+        {
+            const int send_result = pi->config.fn_send(pi, iface, pframes + i);
+            if (send_result == 1)
+                delivered[queue_index[i]] = true;
+            else
+                CANAS_TRACE("send failed: iface=%i result=%i\n", iface, send_result);
+        }
     }
-    return NULL;
+
+    bool sent_successfully = true;
+    for (int i = 0; i < pi->tx_queue_len; i++)
+        sent_successfully = sent_successfully && delivered[i];
+    pi->tx_queue_len = 0;
+    return sent_successfully ? 0 : -CANAS_ERR_DRIVER;
 }
 
-static int _genericSend(CanasInstance* pi, int iface, uint16_t msg_id, uint8_t msggroup, const CanasMessage* pmsg)
+static int _enqueueFrame(CanasInstance* pi, int iface, const CanasCanFrame* pframe)
 {
-    CanasCanFrame frame;
-    int mkframe_result = -1;
-    if (msggroup == MSGGROUP_PARAMETER)
-        mkframe_result = _makeFrame(&frame, msg_id, pmsg, pi->config.redund_channel_id);
-    else
-        mkframe_result = _makeFrame(&frame, msg_id, pmsg, 0);              // redundancy channel 0 is for services
+    if (pi->tx_queue_len >= CANAS_TX_QUEUE_LEN)
+    {
+        const int ret = _flushTxQueue(pi);
+        if (ret != 0)
+        {
+            CANAS_TRACE("tx queue overflow flush failed: %i\n", ret);
+            if (pi->tx_error == 0)
+                pi->tx_error = ret;                  // Will be reported by the outermost canasTxEnd()
+        }
+    }
+    pi->tx_queue[pi->tx_queue_len] = *pframe;
+    pi->tx_queue_ifaces[pi->tx_queue_len] = _ifaceMask(pi, iface);
+    pi->tx_queue_len++;
+    return 0;
+}
 
-    if (mkframe_result != 0)
-        return mkframe_result;
+static int _sendFrame(CanasInstance* pi, int iface, const CanasCanFrame* pframe)
+{
+    CANAS_TRACE("sending %s\n", CANAS_DUMPFRAME(pframe));
 
-    CANAS_TRACE("sending %s\n", CANAS_DUMPFRAME(&frame));
+    if (pi->tx_depth > 0 && pi->config.fn_send_many != NULL)
+        return _enqueueFrame(pi, iface, pframe);
 
     bool sent_successfully = false;
     if (iface < 0)
     {
         for (int i = 0; i < pi->config.iface_count; i++)
         {
-            const int send_result = pi->config.fn_send(pi, i, &frame);
+            const int send_result = pi->config.fn_send(pi, i, pframe);
             if (send_result == 1)
                 sent_successfully = true;            // At least one successful sending is enough to return success.
             else
@@ -282,7 +410,7 @@ static int _genericSend(CanasInstance* pi, int iface, uint16_t msg_id, uint8_t m
     }
     else
     {
-        const int send_result = pi->config.fn_send(pi, iface, &frame);
+        const int send_result = pi->config.fn_send(pi, iface, pframe);
         sent_successfully = send_result == true;
         if (!sent_successfully)
             CANAS_TRACE("send failed: iface=%i result=%i\n", iface, send_result);
@@ -290,6 +418,47 @@ static int _genericSend(CanasInstance* pi, int iface, uint16_t msg_id, uint8_t m
     return sent_successfully ? 0 : -CANAS_ERR_DRIVER;
 }
 
+static int _genericSend(CanasInstance* pi, int iface, uint16_t msg_id, uint8_t msggroup, const CanasMessage* pmsg)
+{
+    CanasCanFrame frame;
+    int mkframe_result = -1;
+    if (msggroup == MSGGROUP_PARAMETER)
+        mkframe_result = _makeFrame(&frame, msg_id, pmsg, pi->config.redund_channel_id);
+    else
+        mkframe_result = _makeFrame(&frame, msg_id, pmsg, 0);              // redundancy channel 0 is for services
+
+    if (mkframe_result != 0)
+        return mkframe_result;
+    return _sendFrame(pi, iface, &frame);
+}
+
+static int _publish(CanasInstance* pi, CanasParamAdvertisement* padv, const CanasMessageData* pdata,
+                    uint8_t service_code)
+{
+    CanasCanFrame* pframe = &padv->frame;          // CAN ID and Node ID are already there
+
+    memset(pframe->data + 4, 0, 4);
+    const int datalen = canasHostToNetwork(pframe->data + 4, pdata);
+    if (datalen < 0)
+    {
+        CANAS_TRACE("publish: bad data type=%i error=%i\n", (int)pdata->type, datalen);
+        return datalen;
+    }
+    pframe->data[1] = pdata->type;
+    pframe->data[2] = service_code;
+    pframe->data[3] = padv->message_code++;       // Keeping the correct value of message code
+    pframe->dlc = datalen + 4;
+
+    int iface = ALL_IFACES;
+    if (padv->interlacing_next_iface >= 0)
+    {
+        iface = padv->interlacing_next_iface++;
+        if (padv->interlacing_next_iface >= pi->config.iface_count)
+            padv->interlacing_next_iface = 0;
+    }
+    return _sendFrame(pi, iface, pframe);
+}
+
 CanasConfig canasMakeConfig(void)
 {
     CanasConfig cfg;
@@ -303,6 +472,8 @@ CanasConfig canasMakeConfig(void)
     return cfg;
 }
 
+static int _loadStaticTable(CanasInstance* pi);
+
 int canasInit(CanasInstance* pi, const CanasConfig* pcfg, void* pthis)
 {
     if (pi == NULL || pcfg == NULL)
@@ -323,47 +494,83 @@ int canasInit(CanasInstance* pi, const CanasConfig* pcfg, void* pthis)
             if ((pcfg->fn_filter(pi, i, &filt, 1)) < 0)
                 return -CANAS_ERR_DRIVER;
     }
-    return 0;
+
+    // Service frame history and the preallocated entries, all in one block
+    int ret = canasArenaInit(pi);
+    if (ret != 0)
+        return ret;
+    ret = _loadStaticTable(pi);
+    if (ret != 0)                                           // Nothing must be left behind on failure
+    {
+        canasIndexClear(pi, pi->param_sub_index, CANAS_MSG_ID_COUNT);
+        canasIndexClear(pi, pi->param_adv_index, CANAS_MSG_ID_COUNT);
+        canasIndexClear(pi, pi->service_index, CANAS_SERVICE_CODE_COUNT);
+        canasArenaRelease(pi);
+    }
+    return ret;
 }
 
-int canasUpdate(CanasInstance* pi, int iface, const CanasCanFrame* pframe)
+static inline bool _isParamInteresting(const CanasInstance* pi, uint16_t msg_id)
 {
-    const uint64_t timestamp = canasTimestamp(pi);
+    return (pi->param_interest[msg_id / 32] & (1ul << (msg_id % 32))) != 0;
+}
 
-    if (pi == NULL)
-        return -CANAS_ERR_ARGUMENT;
-    if (pframe != NULL && (iface >= pi->config.iface_count || iface < 0))
-        return -CANAS_ERR_ARGUMENT;
+static inline void _setParamInterest(CanasInstance* pi, uint16_t msg_id, bool interesting)
+{
+    if (interesting)
+        pi->param_interest[msg_id / 32] |= 1ul << (msg_id % 32);
+    else
+        pi->param_interest[msg_id / 32] &= ~(1ul << (msg_id % 32));
+}
+
+/**
+ * Driver knows better when the frame was received, unless the application provided the time explicitly.
+ */
+static inline uint64_t _frameTimestamp(const CanasCanFrame* pframe, uint64_t current_timestamp)
+{
+    return (pframe != NULL && pframe->timestamp_usec != 0) ? pframe->timestamp_usec : current_timestamp;
+}
+
+static int _handleFrame(CanasInstance* pi, int iface, const CanasCanFrame* pframe, uint64_t timestamp)
+{
+#if !CANAEROSPACE_TRACE_FOREIGN_PARAMS
+    /*
+     * Parameters that nobody is listening to are dropped without decoding.
+     * Malformed frames will be dropped silently as well, since nobody cares.
+     */
+    if (!_hasHook(pi))
+    {
+        const uint16_t id = pframe->id & CANAS_CAN_MASK_STDID;
+        if (!_isParamInteresting(pi, id) && _detectMessageGroup(id) == MSGGROUP_PARAMETER)
+            return 0;
+    }
+#endif
 
     uint16_t msg_id = 0xFFFF;
     CanasMessage msg;
     MessageGroup msggroup = MSGGROUP_WTF;
     uint8_t redund_ch = 0;
-    int ret = 0;
 
-    if (pframe != NULL)
+    //CANAS_TRACE("recv %s\n", CANAS_DUMPFRAME(pframe));
+    int ret = _parseFrame(pframe, &msg_id, &msg, &redund_ch);
+    if (ret == 0)
     {
-        //CANAS_TRACE("recv %s\n", CANAS_DUMPFRAME(pframe));
-        ret = _parseFrame(pframe, &msg_id, &msg, &redund_ch);
-        if (ret == 0)
+        msggroup = _detectMessageGroup(msg_id);
+        if (msggroup == MSGGROUP_WTF)
         {
-            msggroup = _detectMessageGroup(msg_id);
-            if (msggroup == MSGGROUP_WTF)
-            {
-                CANAS_TRACE("update: failed to detect the message group\n");
-                ret = -CANAS_ERR_BAD_MESSAGE_ID;
-            }
+            CANAS_TRACE("update: failed to detect the message group\n");
+            ret = -CANAS_ERR_BAD_MESSAGE_ID;
         }
     }
 
-    if (msggroup != MSGGROUP_WTF && pi->config.fn_hook != NULL)
+    if (msggroup != MSGGROUP_WTF && _hasHook(pi))
         _issueMessageHookCallback(pi, iface, msg_id, &msg, redund_ch, timestamp);
 
     if (msggroup == MSGGROUP_PARAMETER)
     {
         CanasParamSubscription* ppar = _findParamSubscription(pi, msg_id);
         if (ppar != NULL)
-            _handleReceivedParam(pi, ppar, msg_id, &msg, redund_ch, timestamp);
+            ret = _handleReceivedParam(pi, ppar, msg_id, &msg, redund_ch, timestamp);
         else
             CANAS_TRACE("foreign param msgid=%03x datatype=%i\n", (unsigned  int)msg_id, (int)msg.data.type);
     }
@@ -379,12 +586,139 @@ int canasUpdate(CanasInstance* pi, int iface, const CanasCanFrame* pframe)
                 CANAS_TRACE("foreign serv msgid=%03x srvcode=%i\n", (unsigned  int)msg_id, (int)msg.service_code);
         }
     }
+    return ret;
+}
+
+int canasTxBegin(CanasInstance* pi)
+{
+    if (pi == NULL)
+        return -CANAS_ERR_ARGUMENT;
+    if (pi->tx_depth >= CANAS_TX_MAX_DEPTH)
+        return -CANAS_ERR_QUOTA_EXCEEDED;
+    pi->tx_depth++;
+    return 0;
+}
+
+int canasTxEnd(CanasInstance* pi)
+{
+    if (pi == NULL || pi->tx_depth == 0)
+        return -CANAS_ERR_ARGUMENT;
+    if (--pi->tx_depth > 0)
+        return 0;
+    const int ret = _flushTxQueue(pi);
+    const int early_ret = pi->tx_error;
+    pi->tx_error = 0;
+    return (early_ret != 0) ? early_ret : ret;
+}
+
+static int _update(CanasInstance* pi, int iface, const CanasCanFrame* pframe, uint64_t frame_timestamp,
+                   uint64_t current_timestamp)
+{
+    if (pi == NULL)
+        return -CANAS_ERR_ARGUMENT;
+    if (pframe != NULL && (iface >= pi->config.iface_count || iface < 0))
+        return -CANAS_ERR_ARGUMENT;
+
+    const bool batched = canasTxBegin(pi) == 0;    // If the application holds the queue too deep, it will flush it
+
+    int ret = 0;
+    if (pframe != NULL)
+        ret = _handleFrame(pi, iface, pframe, frame_timestamp);
+
+    canasTimerWheelAdvance(pi, current_timestamp);
+    canasPollServices(pi, current_timestamp);
+
+    const int tx_ret = batched ? canasTxEnd(pi) : 0;
+    return (ret != 0) ? ret : tx_ret;
+}
+
+int canasUpdate(CanasInstance* pi, int iface, const CanasCanFrame* pframe)
+{
+    if (pi == NULL)
+        return -CANAS_ERR_ARGUMENT;
+    const uint64_t timestamp = canasTimestamp(pi);
+    return _update(pi, iface, pframe, _frameTimestamp(pframe, timestamp), timestamp);
+}
+
+int canasUpdateAt(CanasInstance* pi, int iface, const CanasCanFrame* pframe, uint64_t timestamp_usec)
+{
+    return _update(pi, iface, pframe, timestamp_usec, timestamp_usec);
+}
+
+int canasUpdateBatch(CanasInstance* pi, const CanasCanFrame* pframes, const uint8_t* pifaces, int nframes)
+{
+    if (pi == NULL || nframes < 0)
+        return -CANAS_ERR_ARGUMENT;
+    if (nframes > 0 && (pframes == NULL || pifaces == NULL))
+        return -CANAS_ERR_ARGUMENT;
+
+    const uint64_t timestamp = canasTimestamp(pi);
+    const bool batched = canasTxBegin(pi) == 0;
+
+    int first_error = 0;
+    for (int i = 0; i < nframes; i++)
+    {
+        int ret = -CANAS_ERR_ARGUMENT;
+        if (pifaces[i] < pi->config.iface_count)
+            ret = _handleFrame(pi, pifaces[i], pframes + i, _frameTimestamp(pframes + i, timestamp));
+        if (ret != 0 && first_error == 0)
+            first_error = ret;          // One bad frame must not prevent the rest of the batch from being processed
+    }
+
+    canasTimerWheelAdvance(pi, timestamp);
     canasPollServices(pi, timestamp);
+
+    const int tx_ret = batched ? canasTxEnd(pi) : 0;
+    return (first_error != 0) ? first_error : tx_ret;
+}
+
+uint64_t canasGetNextDeadline(CanasInstance* pi)
+{
+    if (pi == NULL)
+        return 0;
+    const uint64_t services = canasServicesNextDeadline(pi);
+    const uint64_t timers = canasTimerWheelNextDeadline(pi);
+    return (services < timers) ? services : timers;
+}
+
+static bool _isStaticSubscription(const CanasInstance* pi, const CanasParamSubscription* psub)
+{
+    const CanasStaticTable* ptable = pi->config.pstatic_table;
+    return ptable != NULL && (const uint8_t*)psub >= (const uint8_t*)ptable->psubscription_storage &&
+        (const uint8_t*)psub < pi->pstatic_subs_end;
+}
+
+static bool _isStaticAdvertisement(const CanasInstance* pi, const CanasParamAdvertisement* padv)
+{
+    const CanasStaticTable* ptable = pi->config.pstatic_table;
+    return ptable != NULL && padv >= ptable->padvertisement_storage &&
+        padv < ptable->padvertisement_storage + ptable->num_advertisements;
+}
+
+/**
+ * Memory must be zeroed.
+ */
+static int _insertParamSubscription(CanasInstance* pi, CanasParamSubscription* psub, uint16_t msg_id,
+                                    uint8_t redund_chan_count, CanasParamCallbackFn callback,
+                                    CanasParamCallbackRefFn callback_ref, void* callback_arg)
+{
+    psub->callback = callback;
+    psub->callback_ref = callback_ref;
+    psub->callback_arg = callback_arg;
+    psub->message_id = msg_id;
+    psub->redund_count = redund_chan_count;
+
+    const CanasParamMeta* pmeta = canasParamMetaFind(pi->config.pparam_registry, msg_id);
+    psub->type_mask = (pmeta != NULL) ? pmeta->type_mask : 0;
+
+    const int ret = canasIndexInsert(pi, pi->param_sub_index, msg_id, psub);
+    if (ret == 0)
+        _setParamInterest(pi, msg_id, true);
     return ret;
 }
 
-int canasParamSubscribe(CanasInstance* pi, uint16_t msg_id, uint8_t redund_chan_count,
-                        CanasParamCallbackFn callback, void* callback_arg)
+static int _paramSubscribe(CanasInstance* pi, uint16_t msg_id, uint8_t redund_chan_count,
+                           CanasParamCallbackFn callback, CanasParamCallbackRefFn callback_ref, void* callback_arg)
 {
     if (pi == NULL)
         return -CANAS_ERR_ARGUMENT;
@@ -399,18 +733,28 @@ int canasParamSubscribe(CanasInstance* pi, uint16_t msg_id, uint8_t redund_chan_
     // this size magic is necessary because C++ does not allow flexible and zero-length arrays
     int size = sizeof(CanasParamSubscription) +
         sizeof(CanasParamCacheEntry) * redund_chan_count - sizeof(CanasParamCacheEntry);
-    CanasParamSubscription* psub = canasMalloc(pi, size);
+    CanasParamSubscription* psub = canasArenaAlloc(pi, &pi->arena_param_subs, size);
     if (psub == NULL)
         return -CANAS_ERR_NOT_ENOUGH_MEMORY;
 
     memset(psub, 0, size);
-    psub->callback = callback;
-    psub->callback_arg = callback_arg;
-    psub->message_id = msg_id;
-    psub->redund_count = redund_chan_count;
+    const int ret = _insertParamSubscription(pi, psub, msg_id, redund_chan_count, callback, callback_ref,
+                                             callback_arg);
+    if (ret != 0)
+        canasArenaFree(pi, &pi->arena_param_subs, psub);
+    return ret;
+}
 
-    canasListInsert((CanasListEntry**)&pi->pparam_subs, psub);
-    return 0;
+int canasParamSubscribe(CanasInstance* pi, uint16_t msg_id, uint8_t redund_chan_count,
+                        CanasParamCallbackFn callback, void* callback_arg)
+{
+    return _paramSubscribe(pi, msg_id, redund_chan_count, callback, NULL, callback_arg);
+}
+
+int canasParamSubscribeRef(CanasInstance* pi, uint16_t msg_id, uint8_t redund_chan_count,
+                           CanasParamCallbackRefFn callback, void* callback_arg)
+{
+    return _paramSubscribe(pi, msg_id, redund_chan_count, NULL, callback, callback_arg);
 }
 
 int canasParamUnsubscribe(CanasInstance* pi, uint16_t msg_id)
@@ -421,8 +765,12 @@ int canasParamUnsubscribe(CanasInstance* pi, uint16_t msg_id)
     CanasParamSubscription* psub = _findParamSubscription(pi, msg_id);
     if (psub != NULL)
     {
-        canasListRemove((CanasListEntry**)&pi->pparam_subs, psub);
-        canasFree(pi, psub);
+        canasIndexRemove(pi, pi->param_sub_index, msg_id);
+        _setParamInterest(pi, msg_id, false);
+        if (_isStaticSubscription(pi, psub))
+            psub->message_id = REMOVED_MESSAGE_ID;
+        else
+            canasArenaFree(pi, &pi->arena_param_subs, psub);
         return 0;
     }
     return -CANAS_ERR_NO_SUCH_ENTRY;
@@ -438,8 +786,12 @@ int canasParamRead(CanasInstance* pi, uint16_t msg_id, uint8_t redund_chan, Cana
     {
         if (redund_chan >= psub->redund_count)
             return -CANAS_ERR_BAD_REDUND_CHAN;
-        pargs->message = psub->redund_cache[redund_chan].message;
-        pargs->timestamp_usec = psub->redund_cache[redund_chan].timestamp_usec;
+        CanasParamCacheEntry entry;
+        const int ret = canasParamCacheCopy(psub->redund_cache + redund_chan, &entry);
+        if (ret != 0)
+            return ret;
+        pargs->message = entry.message;
+        pargs->timestamp_usec = entry.timestamp_usec;
         pargs->message_id = msg_id;
         pargs->parg = psub->callback_arg;
         pargs->redund_channel_id = redund_chan;
@@ -448,27 +800,141 @@ int canasParamRead(CanasInstance* pi, uint16_t msg_id, uint8_t redund_chan, Cana
     return -CANAS_ERR_NO_SUCH_ENTRY;
 }
 
-int canasParamAdvertise(CanasInstance* pi, uint16_t msg_id, bool interlaced)
+int canasParamSnapshotInit(CanasInstance* pi, CanasParamSnapshot* psnap, const CanasParamSnapshotItem* pitems,
+                           int num_items, const CanasParamCacheEntry** ppentries)
 {
-    if (pi == NULL)
+    if (pi == NULL || psnap == NULL || num_items < 0 || num_items > 0xFFFF)
+        return -CANAS_ERR_ARGUMENT;
+    if (num_items > 0 && (pitems == NULL || ppentries == NULL))
         return -CANAS_ERR_ARGUMENT;
-    if (_detectMessageGroup(msg_id) != MSGGROUP_PARAMETER)
-        return -CANAS_ERR_BAD_MESSAGE_ID;
-    if (_findParamAdvertisement(pi, msg_id) != NULL)
-        return -CANAS_ERR_ENTRY_EXISTS;
 
-    CanasParamAdvertisement* padv = canasMalloc(pi, sizeof(CanasParamAdvertisement));
-    if (padv == NULL)
-        return -CANAS_ERR_NOT_ENOUGH_MEMORY;
+    memset(psnap, 0, sizeof(*psnap));
+    for (int i = 0; i < num_items; i++)
+    {
+        const CanasParamSubscription* psub = _findParamSubscription(pi, pitems[i].message_id);
+        if (psub == NULL)
+            return -CANAS_ERR_NO_SUCH_ENTRY;
+        if (pitems[i].redund_chan >= psub->redund_count)
+            return -CANAS_ERR_BAD_REDUND_CHAN;
+        ppentries[i] = psub->redund_cache + pitems[i].redund_chan;
+    }
+    psnap->pi = pi;
+    psnap->ppentries = ppentries;
+    psnap->num_items = num_items;
+    return 0;
+}
+
+static int _copySnapshot(const CanasParamSnapshot* psnap, uint64_t timestamp_usec, uint64_t max_age_usec,
+                         CanasParamSnapshotData* pdata)
+{
+    int num_fresh = 0;
+    for (int i = 0; i < psnap->num_items; i++)
+    {
+        const CanasParamCacheEntry* pentry = psnap->ppentries[i];
+        const uint64_t ts = pentry->timestamp_usec;
+        // The entry may be newer than the caller's idea of the current time
+        const bool fresh = ts > 0 && (max_age_usec == 0 || ts >= timestamp_usec || timestamp_usec - ts <= max_age_usec);
+        num_fresh += fresh;
+        if (pdata->pvalues != NULL)
+            pdata->pvalues[i] = pentry->message.data;
+        if (pdata->ptimestamps_usec != NULL)
+            pdata->ptimestamps_usec[i] = ts;
+        if (pdata->pmessage_codes != NULL)
+            pdata->pmessage_codes[i] = pentry->message.message_code;
+        if (pdata->pfresh != NULL)
+            pdata->pfresh[i] = fresh;
+    }
+    return num_fresh;
+}
+
+#if CANAEROSPACE_SEQLOCK
+/**
+ * The counters only grow, so their sum stays the same only if none of the entries was written in between
+ * (short of 2^31 writes during one copy). This way the counters need not be stored per item.
+ * @return false if some entry is being written right now
+ */
+static bool _sumSnapshotSeq(const CanasParamSnapshot* psnap, uint32_t* psum)
+{
+    uint32_t sum = 0;
+    for (int i = 0; i < psnap->num_items; i++)
+    {
+        const uint32_t seq = __atomic_load_n(&psnap->ppentries[i]->seq, __ATOMIC_ACQUIRE);
+        if (seq & 1)
+            return false;
+        sum += seq;
+    }
+    *psum = sum;
+    return true;
+}
+#endif
+
+int canasParamSnapshotTake(const CanasParamSnapshot* psnap, uint64_t timestamp_usec, uint64_t max_age_usec,
+                           CanasParamSnapshotData* pdata)
+{
+    if (psnap == NULL || pdata == NULL || psnap->pi == NULL)
+        return -CANAS_ERR_ARGUMENT;
+#if CANAEROSPACE_SEQLOCK
+    for (int attempt = 0; attempt < CANAS_SEQLOCK_MAX_RETRIES; attempt++)
+    {
+        uint32_t seq_before = 0, seq_after = 0;
+        if (!_sumSnapshotSeq(psnap, &seq_before))
+            continue;
+        const int num_fresh = _copySnapshot(psnap, timestamp_usec, max_age_usec, pdata);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);                // Data is read before the counters are checked again
+        if (_sumSnapshotSeq(psnap, &seq_after) && seq_after == seq_before)
+            return num_fresh;
+    }
+    return -CANAS_ERR_BUSY;
+#else
+    return _copySnapshot(psnap, timestamp_usec, max_age_usec, pdata);
+#endif
+}
+
+static int _insertParamAdvertisement(CanasInstance* pi, CanasParamAdvertisement* padv, uint16_t msg_id,
+                                     bool interlaced)
+{
     memset(padv, 0, sizeof(*padv));
     padv->message_id = msg_id;
 
+    CanasMessage header;
+    memset(&header, 0, sizeof(header));
+    header.node_id = pi->config.node_id;
+    _makeFrame(&padv->frame, msg_id, &header, pi->config.redund_channel_id);  // NODATA can't fail
+
     // Interlacing is only enabled if we have more than one interface (obviously)
     if (pi->config.iface_count < 2)
         interlaced = false;
     padv->interlacing_next_iface = interlaced ? 0 : ALL_IFACES;
 
-    canasListInsert((CanasListEntry**)&pi->pparam_advs, padv);
+    return canasIndexInsert(pi, pi->param_adv_index, msg_id, padv);
+}
+
+int canasParamAdvertise(CanasInstance* pi, uint16_t msg_id, bool interlaced)
+{
+    CanasParamHandle handle = NULL;
+    return canasParamAdvertiseHandle(pi, msg_id, interlaced, &handle);
+}
+
+int canasParamAdvertiseHandle(CanasInstance* pi, uint16_t msg_id, bool interlaced, CanasParamHandle* phandle)
+{
+    if (pi == NULL || phandle == NULL)
+        return -CANAS_ERR_ARGUMENT;
+    if (_detectMessageGroup(msg_id) != MSGGROUP_PARAMETER)
+        return -CANAS_ERR_BAD_MESSAGE_ID;
+    if (_findParamAdvertisement(pi, msg_id) != NULL)
+        return -CANAS_ERR_ENTRY_EXISTS;
+
+    CanasParamAdvertisement* padv = canasArenaAlloc(pi, &pi->arena_param_advs, sizeof(CanasParamAdvertisement));
+    if (padv == NULL)
+        return -CANAS_ERR_NOT_ENOUGH_MEMORY;
+
+    const int ret = _insertParamAdvertisement(pi, padv, msg_id, interlaced);
+    if (ret != 0)
+    {
+        canasArenaFree(pi, &pi->arena_param_advs, padv);
+        return ret;
+    }
+    *phandle = padv;
     return 0;
 }
 
@@ -480,41 +946,81 @@ int canasParamUnadvertise(CanasInstance* pi, uint16_t msg_id)
     CanasParamAdvertisement* padv = _findParamAdvertisement(pi, msg_id);
     if (padv != NULL)
     {
-        canasListRemove((CanasListEntry**)&pi->pparam_advs, padv);
-        canasFree(pi, padv);
+        canasIndexRemove(pi, pi->param_adv_index, msg_id);
+        if (_isStaticAdvertisement(pi, padv))
+            padv->message_id = REMOVED_MESSAGE_ID;
+        else
+            canasArenaFree(pi, &pi->arena_param_advs, padv);
         return 0;
     }
     return -CANAS_ERR_NO_SUCH_ENTRY;
 }
 
+/**
+ * The entries are placed into the storage provided by the application, so nothing is allocated
+ * (except for the index pages in compact mode).
+ */
+static int _loadStaticTable(CanasInstance* pi)
+{
+    const CanasStaticTable* ptable = pi->config.pstatic_table;
+    if (ptable == NULL)
+        return 0;
+    if ((ptable->num_subscriptions > 0 && (ptable->psubscriptions == NULL || ptable->psubscription_storage == NULL)) ||
+        (ptable->num_advertisements > 0 && (ptable->padvertisements == NULL || ptable->padvertisement_storage == NULL)))
+        return -CANAS_ERR_ARGUMENT;
+
+    uint8_t* pstorage = (uint8_t*)ptable->psubscription_storage;
+    for (int i = 0; i < ptable->num_subscriptions; i++)
+    {
+        const CanasStaticSubscription* pentry = ptable->psubscriptions + i;
+        if (_detectMessageGroup(pentry->message_id) != MSGGROUP_PARAMETER)
+            return -CANAS_ERR_BAD_MESSAGE_ID;
+        if (pentry->redund_count < 1)
+            return -CANAS_ERR_BAD_REDUND_CHAN;
+
+        CanasParamSubscription* psub = (CanasParamSubscription*)pstorage;
+        memset(psub, 0, CANAS_PARAM_SUBSCRIPTION_SIZE(pentry->redund_count));
+        const int ret = _insertParamSubscription(pi, psub, pentry->message_id, pentry->redund_count,
+                                                 pentry->callback, pentry->callback_ref, pentry->callback_arg);
+        if (ret != 0)
+            return ret;
+        pstorage += CANAS_PARAM_SUBSCRIPTION_SIZE(pentry->redund_count);
+    }
+    pi->pstatic_subs_end = pstorage;
+
+    for (int i = 0; i < ptable->num_advertisements; i++)
+    {
+        const CanasStaticAdvertisement* pentry = ptable->padvertisements + i;
+        if (_detectMessageGroup(pentry->message_id) != MSGGROUP_PARAMETER)
+            return -CANAS_ERR_BAD_MESSAGE_ID;
+        const int ret = _insertParamAdvertisement(pi, ptable->padvertisement_storage + i, pentry->message_id,
+                                                  pentry->interlaced);
+        if (ret != 0)
+            return ret;
+    }
+    return 0;
+}
+
 int canasParamPublish(CanasInstance* pi, uint16_t msg_id, const CanasMessageData* pdata, uint8_t service_code)
 {
     if (pi == NULL || pdata == NULL)
         return -CANAS_ERR_ARGUMENT;
 
-    const uint8_t msggroup = _detectMessageGroup(msg_id);
-    if (msggroup != MSGGROUP_PARAMETER)
+    if (_detectMessageGroup(msg_id) != MSGGROUP_PARAMETER)
         return -CANAS_ERR_BAD_MESSAGE_ID;
 
     CanasParamAdvertisement* padv = _findParamAdvertisement(pi, msg_id);
     if (padv == NULL)
         return -CANAS_ERR_NO_SUCH_ENTRY;
+    return _publish(pi, padv, pdata, service_code);
+}
 
-    int iface = ALL_IFACES;
-    if (padv->interlacing_next_iface >= 0)
-    {
-        iface = padv->interlacing_next_iface++;
-        if (padv->interlacing_next_iface >= pi->config.iface_count)
-            padv->interlacing_next_iface = 0;
-    }
-
-    CanasMessage msg;
-    memset(&msg, 0, sizeof(msg));
-    msg.node_id = pi->config.node_id;
-    msg.service_code = service_code;
-    msg.message_code = padv->message_code++;    // Keeping the correct value of message code
-    msg.data = *pdata;
-    return _genericSend(pi, iface, msg_id, msggroup, &msg);
+int canasParamPublishHandle(CanasInstance* pi, CanasParamHandle handle, const CanasMessageData* pdata,
+                            uint8_t service_code)
+{
+    if (pi == NULL || handle == NULL || pdata == NULL)
+        return -CANAS_ERR_ARGUMENT;
+    return _publish(pi, handle, pdata, service_code);
 }
 
 int canasServiceSendRequest(CanasInstance* pi, const CanasMessage* pmsg)
@@ -552,36 +1058,69 @@ int canasServiceSendResponse(CanasInstance* pi, const CanasMessage* pmsg, uint8_
     return _genericSend(pi, ALL_IFACES, (uint16_t)msg_id, MSGGROUP_SERVICE, &msg);
 }
 
-int canasServiceRegister(CanasInstance* pi, uint8_t service_code, CanasServicePollCallbackFn callback_poll,
-                         CanasServiceRequestCallbackFn callback_request,
-                         CanasServiceResponseCallbackFn callback_response, void* pstate)
+static int _serviceRegister(CanasInstance* pi, uint8_t service_code, CanasServicePollCallbackFn callback_poll,
+                            CanasServiceRequestCallbackFn callback_request,
+                            CanasServiceResponseCallbackFn callback_response,
+                            CanasServiceRequestCallbackRefFn callback_request_ref,
+                            CanasServiceResponseCallbackRefFn callback_response_ref, void* pstate)
 {
     if (pi == NULL)
         return -CANAS_ERR_ARGUMENT;
     if (_findServiceSubscription(pi, service_code) != NULL)
         return -CANAS_ERR_ENTRY_EXISTS;
 
-    // this size magic is necessary because C++ does not allow flexible and zero-length arrays
-    int size = sizeof(CanasServiceSubscription) +
-        sizeof(CanasServiceFrameHistoryEntry) * pi->config.service_frame_hist_len - sizeof(CanasServiceFrameHistoryEntry);
-    CanasServiceSubscription* psrv = canasMalloc(pi, size);
+    CanasServiceSubscription* psrv = canasArenaAlloc(pi, &pi->arena_services, sizeof(CanasServiceSubscription));
     if (psrv == NULL)
         return -CANAS_ERR_NOT_ENOUGH_MEMORY;
 
-    memset(psrv, 0, size);
+    memset(psrv, 0, sizeof(CanasServiceSubscription));
     psrv->callback_poll = callback_poll;
     psrv->callback_request = callback_request;
     psrv->callback_response = callback_response;
+    psrv->callback_request_ref = callback_request_ref;
+    psrv->callback_response_ref = callback_response_ref;
     psrv->pstate = pstate;
-    psrv->history_len = pi->config.service_frame_hist_len;
     psrv->service_code = service_code;
-    for (int i = 0; i < psrv->history_len; i++)
-        psrv->history[i].ifaces_mask = 0xFF;        // Default value, to avoid false-positives on repetition detection
 
+    const int ret = canasIndexInsert(pi, pi->service_index, service_code, psrv);
+    if (ret != 0)
+    {
+        canasArenaFree(pi, &pi->arena_services, psrv);
+        return ret;
+    }
+    // The list is only needed to poll the services, and there are few of them
     canasListInsert((CanasListEntry**)&pi->pservice_subs, psrv);
     return 0;
 }
 
+int canasServiceRegister(CanasInstance* pi, uint8_t service_code, CanasServicePollCallbackFn callback_poll,
+                         CanasServiceRequestCallbackFn callback_request,
+                         CanasServiceResponseCallbackFn callback_response, void* pstate)
+{
+    return _serviceRegister(pi, service_code, callback_poll, callback_request, callback_response, NULL, NULL, pstate);
+}
+
+int canasServiceRegisterRef(CanasInstance* pi, uint8_t service_code, CanasServicePollCallbackFn callback_poll,
+                            CanasServiceRequestCallbackRefFn callback_request,
+                            CanasServiceResponseCallbackRefFn callback_response, void* pstate)
+{
+    return _serviceRegister(pi, service_code, callback_poll, NULL, NULL, callback_request, callback_response, pstate);
+}
+
+int canasServiceSetDeadlineCallback(CanasInstance* pi, uint8_t service_code, CanasServiceDeadlineCallbackFn callback)
+{
+    if (pi == NULL)
+        return -CANAS_ERR_ARGUMENT;
+
+    CanasServiceSubscription* psrv = _findServiceSubscription(pi, service_code);
+    if (psrv != NULL)
+    {
+        psrv->callback_deadline = callback;
+        return 0;
+    }
+    return -CANAS_ERR_NO_SUCH_ENTRY;
+}
+
 int canasServiceUnregister(CanasInstance* pi, uint8_t service_code)
 {
     if (pi == NULL)
@@ -590,8 +1129,9 @@ int canasServiceUnregister(CanasInstance* pi, uint8_t service_code)
     CanasServiceSubscription* psrv = _findServiceSubscription(pi, service_code);
     if (psrv != NULL)
     {
+        canasIndexRemove(pi, pi->service_index, service_code);
         canasListRemove((CanasListEntry**)&pi->pservice_subs, psrv);
-        canasFree(pi, psrv);
+        canasArenaFree(pi, &pi->arena_services, psrv);
         return 0;
     }
     return -CANAS_ERR_NO_SUCH_ENTRY;
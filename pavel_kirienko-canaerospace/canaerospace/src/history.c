@@ -0,0 +1,122 @@
+/*
+ * Repetition detection for service frames
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include <string.h>
+#include "history.h"
+
+static inline uint16_t _homeSlot(const CanasServiceHistory* ph, uint32_t header)
+{
+    // Headers of consecutive frames differ in one byte only, so all bytes must be mixed into the lower bits
+    uint32_t h = header ^ (header >> 16);
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    return (uint16_t)h & ph->slots_mask;
+}
+
+/**
+ * Returns the slot that refers to the newest entry with this header, or the empty slot where it should be.
+ */
+static uint16_t _findSlot(const CanasServiceHistory* ph, uint32_t header)
+{
+    uint16_t slot = _homeSlot(ph, header);
+    while (ph->pslots[slot] != 0 && ph->pentries[ph->pslots[slot] - 1].header != header)
+        slot = (slot + 1) & ph->slots_mask;
+    return slot;
+}
+
+/**
+ * Backward shift deletion, so the probe sequences of the remaining keys stay unbroken.
+ */
+static void _removeSlot(CanasServiceHistory* ph, uint16_t slot)
+{
+    uint16_t next = (slot + 1) & ph->slots_mask;
+    while (ph->pslots[next] != 0)
+    {
+        const uint16_t home = _homeSlot(ph, ph->pentries[ph->pslots[next] - 1].header);
+        // Can the key from the next slot be moved to the freed one without getting ahead of its home?
+        const bool movable = (slot <= next) ? (home <= slot || home > next) : (home <= slot && home > next);
+        if (movable)
+        {
+            ph->pslots[slot] = ph->pslots[next];
+            slot = next;
+        }
+        next = (next + 1) & ph->slots_mask;
+    }
+    ph->pslots[slot] = 0;
+}
+
+int canasHistorySlotCount(uint8_t len)
+{
+    int count = 1;
+    while (count < len * 2)
+        count *= 2;
+    return count;
+}
+
+void canasHistoryInit(CanasServiceHistory* ph, CanasServiceFrameHistoryEntry* pentries, uint8_t* pslots, uint8_t len)
+{
+    memset(ph, 0, sizeof(*ph));
+    ph->pentries = pentries;
+    ph->pslots = pslots;
+    ph->len = len;
+    ph->slots_mask = canasHistorySlotCount(len) - 1;
+    memset(pentries, 0, sizeof(CanasServiceFrameHistoryEntry) * len);
+    memset(pslots, 0, canasHistorySlotCount(len));
+}
+
+bool canasHistoryCheckRepetition(CanasServiceHistory* ph, uint32_t header, uint8_t iface, uint64_t timestamp_usec,
+                                 uint32_t repeat_timeout_usec)
+{
+    if (ph->len == 0)
+        return false;
+
+    /*
+     * The same frame may have been received several times from one interface before its copies arrived from
+     * the other ones, so each copy is matched with the oldest entry that has not seen this interface yet.
+     */
+    const uint16_t slot = _findSlot(ph, header);
+    CanasServiceFrameHistoryEntry* pmatch = NULL;
+    for (uint8_t index = ph->pslots[slot]; index != 0; index = ph->pentries[index - 1].older)
+    {
+        CanasServiceFrameHistoryEntry* pentry = ph->pentries + index - 1;
+        if ((timestamp_usec - pentry->timestamp_usec) > repeat_timeout_usec)
+            break;                                                  // The older ones are expired too
+        if (!(pentry->ifaces_mask & (1 << iface)))                  // Interface matched - no repetition
+            pmatch = pentry;
+    }
+    if (pmatch != NULL)
+    {
+        pmatch->ifaces_mask |= 1 << iface;                          // Mark bit of this iface and that's it.
+        return true;
+    }
+
+    // Replace the oldest entry, which is always the last one in its chain
+    const uint8_t index = ph->next;
+    ph->next = (ph->next + 1 < ph->len) ? (ph->next + 1) : 0;
+    CanasServiceFrameHistoryEntry* pentry = ph->pentries + index;
+    if (pentry->ifaces_mask != 0)                                   // Empty entries have no interfaces marked
+    {
+        const uint16_t old_slot = _findSlot(ph, pentry->header);
+        if (ph->pslots[old_slot] == index + 1)
+        {
+            _removeSlot(ph, old_slot);
+        }
+        else
+        {
+            CanasServiceFrameHistoryEntry* pnewer = ph->pentries + ph->pslots[old_slot] - 1;
+            while (pnewer->older != index + 1)
+                pnewer = ph->pentries + pnewer->older - 1;
+            pnewer->older = 0;
+        }
+    }
+
+    const uint16_t new_slot = _findSlot(ph, header);                // May have moved after the removal
+    pentry->header = header;
+    pentry->ifaces_mask = 1 << iface;
+    pentry->timestamp_usec = timestamp_usec;
+    pentry->older = ph->pslots[new_slot];
+    ph->pslots[new_slot] = index + 1;
+    return false;
+}
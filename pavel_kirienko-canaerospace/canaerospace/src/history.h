@@ -0,0 +1,39 @@
+/*
+ * Repetition detection for service frames
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#ifndef CANAEROSPACE_HISTORY_H_
+#define CANAEROSPACE_HISTORY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <canaerospace/canaerospace.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Number of hash table slots required for the given number of entries; the load factor never exceeds 1/2.
+ */
+int canasHistorySlotCount(uint8_t len);
+
+/**
+ * @param [in] pentries Array of len entries
+ * @param [in] pslots   Array of @ref canasHistorySlotCount() bytes
+ */
+void canasHistoryInit(CanasServiceHistory* ph, CanasServiceFrameHistoryEntry* pentries, uint8_t* pslots, uint8_t len);
+
+/**
+ * Returns true if the frame is a repetition of a frame received earlier from another interface within
+ * repeat_timeout_usec; the interface will be marked then. Otherwise, the frame will be recorded as a new one.
+ * Cost does not depend on the history length.
+ */
+bool canasHistoryCheckRepetition(CanasServiceHistory* ph, uint32_t header, uint8_t iface, uint64_t timestamp_usec,
+                                 uint32_t repeat_timeout_usec);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
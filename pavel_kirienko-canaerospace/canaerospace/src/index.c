@@ -0,0 +1,77 @@
+/*
+ * Constant-time lookup tables keyed by Message ID or Service Code
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include <string.h>
+#include "index.h"
+
+#if CANAEROSPACE_COMPACT_INDEX
+
+int canasIndexInsert(CanasInstance* pi, void** pindex, uint16_t key, void* pentry)
+{
+    CanasIndexPage* ppage = (CanasIndexPage*)pindex[key / CANAS_INDEX_PAGE_LEN];
+    if (ppage == NULL)
+    {
+        ppage = canasMalloc(pi, sizeof(CanasIndexPage));
+        if (ppage == NULL)
+            return -CANAS_ERR_NOT_ENOUGH_MEMORY;
+        memset(ppage, 0, sizeof(*ppage));
+        pindex[key / CANAS_INDEX_PAGE_LEN] = ppage;
+    }
+    if (ppage->entries[key % CANAS_INDEX_PAGE_LEN] != NULL)
+        return -CANAS_ERR_ENTRY_EXISTS;
+    ppage->entries[key % CANAS_INDEX_PAGE_LEN] = pentry;
+    ppage->used++;
+    return 0;
+}
+
+void canasIndexRemove(CanasInstance* pi, void** pindex, uint16_t key)
+{
+    CanasIndexPage* ppage = (CanasIndexPage*)pindex[key / CANAS_INDEX_PAGE_LEN];
+    if (ppage == NULL || ppage->entries[key % CANAS_INDEX_PAGE_LEN] == NULL)
+        return;
+    ppage->entries[key % CANAS_INDEX_PAGE_LEN] = NULL;
+    ppage->used--;
+    // Static allocators can't take the page back, so it will be reused instead
+    if (ppage->used == 0 && pi->config.fn_free != NULL)
+    {
+        pindex[key / CANAS_INDEX_PAGE_LEN] = NULL;
+        canasFree(pi, ppage);
+    }
+}
+
+void canasIndexClear(CanasInstance* pi, void** pindex, int num_keys)
+{
+    for (int i = 0; i < CANAS_INDEX_SLOTS(num_keys); i++)
+    {
+        if (pindex[i] != NULL)
+            canasFree(pi, pindex[i]);
+        pindex[i] = NULL;
+    }
+}
+
+#else
+
+int canasIndexInsert(CanasInstance* pi, void** pindex, uint16_t key, void* pentry)
+{
+    (void)pi;
+    if (pindex[key] != NULL)
+        return -CANAS_ERR_ENTRY_EXISTS;
+    pindex[key] = pentry;
+    return 0;
+}
+
+void canasIndexRemove(CanasInstance* pi, void** pindex, uint16_t key)
+{
+    (void)pi;
+    pindex[key] = NULL;
+}
+
+void canasIndexClear(CanasInstance* pi, void** pindex, int num_keys)
+{
+    (void)pi;
+    memset(pindex, 0, sizeof(void*) * num_keys);
+}
+
+#endif
@@ -0,0 +1,58 @@
+/*
+ * Constant-time lookup tables keyed by Message ID or Service Code
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#ifndef CANAEROSPACE_INDEX_H_
+#define CANAEROSPACE_INDEX_H_
+
+#include <stdint.h>
+#include <canaerospace/canaerospace.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if CANAEROSPACE_COMPACT_INDEX
+
+typedef struct
+{
+    void* entries[CANAS_INDEX_PAGE_LEN];
+    uint8_t used;
+} CanasIndexPage;
+
+static inline void* canasIndexGet(void* const* pindex, uint16_t key)
+{
+    const CanasIndexPage* ppage = (const CanasIndexPage*)pindex[key / CANAS_INDEX_PAGE_LEN];
+    return (ppage != NULL) ? ppage->entries[key % CANAS_INDEX_PAGE_LEN] : NULL;
+}
+
+#else
+
+static inline void* canasIndexGet(void* const* pindex, uint16_t key)
+{
+    return pindex[key];
+}
+
+#endif
+
+/**
+ * Entry must not exist. In compact mode this function may allocate memory for a new page.
+ * @return @ref CanasErrorCode
+ */
+int canasIndexInsert(CanasInstance* pi, void** pindex, uint16_t key, void* pentry);
+
+/**
+ * Removes the entry if it exists. In compact mode empty pages will be deallocated.
+ */
+void canasIndexRemove(CanasInstance* pi, void** pindex, uint16_t key);
+
+/**
+ * Drops all entries. In compact mode the pages will be deallocated.
+ */
+void canasIndexClear(CanasInstance* pi, void** pindex, int num_keys);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -15,135 +15,132 @@
 
 #define IS_UDEF(type) ((type) >= CANAS_DATATYPE_UDEF_BEGIN_ && (type) <= CANAS_DATATYPE_UDEF_END_)
 
-#if __BYTE_ORDER__ == __BIG_ENDIAN
-#  define SWITCH(x)
-#else
+typedef struct
+{
+    uint8_t length;        ///< Number of bytes on the wire
+    uint8_t swap_width;    ///< Size of each scalar in the container; bytes are swapped within every scalar
+} MarshalDescriptor;
 
-static inline void _switchByteOrder(void* ptr, int len)
+/*
+ * Target platform must support IEEE754 floats. The good news that almost every platform does that.
+ * But if some platform doesn't, proper converting from native float representation to IEEE754
+ * (and vice versa) must be implemented for FLOAT, DOUBLEH and DOUBLEL.
+ */
+static const MarshalDescriptor _descriptors[CANAS_DATATYPE_RESVD_BEGIN_] =
 {
-    uint8_t tmp[4], *pbyte = ptr;
-    if (len == 2)
-    {
-        memcpy(tmp, ptr, 2);
-        pbyte[0] = tmp[1];
-        pbyte[1] = tmp[0];
-    }
-    else if (len == 4)
-    {
-        memcpy(tmp, ptr, 4);
-        pbyte[0] = tmp[3];
-        pbyte[1] = tmp[2];
-        pbyte[2] = tmp[1];
-        pbyte[3] = tmp[0];
-    }
+    [CANAS_DATATYPE_NODATA]  = { 0, 1 },
+    [CANAS_DATATYPE_ERROR]   = { 4, 4 },
+
+    [CANAS_DATATYPE_FLOAT]   = { 4, 4 },
+
+    [CANAS_DATATYPE_LONG]    = { 4, 4 },
+    [CANAS_DATATYPE_ULONG]   = { 4, 4 },
+    [CANAS_DATATYPE_BLONG]   = { 4, 4 },
+
+    [CANAS_DATATYPE_SHORT]   = { 2, 2 },
+    [CANAS_DATATYPE_USHORT]  = { 2, 2 },
+    [CANAS_DATATYPE_BSHORT]  = { 2, 2 },
+
+    [CANAS_DATATYPE_CHAR]    = { 1, 1 },
+    [CANAS_DATATYPE_UCHAR]   = { 1, 1 },
+    [CANAS_DATATYPE_BCHAR]   = { 1, 1 },
+
+    [CANAS_DATATYPE_SHORT2]  = { 4, 2 },
+    [CANAS_DATATYPE_USHORT2] = { 4, 2 },
+    [CANAS_DATATYPE_BSHORT2] = { 4, 2 },
+
+    [CANAS_DATATYPE_CHAR4]   = { 4, 1 },
+    [CANAS_DATATYPE_UCHAR4]  = { 4, 1 },
+    [CANAS_DATATYPE_BCHAR4]  = { 4, 1 },
+
+    [CANAS_DATATYPE_CHAR2]   = { 2, 1 },
+    [CANAS_DATATYPE_UCHAR2]  = { 2, 1 },
+    [CANAS_DATATYPE_BCHAR2]  = { 2, 1 },
+
+    [CANAS_DATATYPE_MEMID]   = { 4, 4 },
+    [CANAS_DATATYPE_CHKSUM]  = { 4, 4 },
+
+    [CANAS_DATATYPE_ACHAR]   = { 1, 1 },
+    [CANAS_DATATYPE_ACHAR2]  = { 2, 1 },
+    [CANAS_DATATYPE_ACHAR4]  = { 4, 1 },
+
+    [CANAS_DATATYPE_CHAR3]   = { 3, 1 },
+    [CANAS_DATATYPE_UCHAR3]  = { 3, 1 },
+    [CANAS_DATATYPE_BCHAR3]  = { 3, 1 },
+    [CANAS_DATATYPE_ACHAR3]  = { 3, 1 },
+
+    [CANAS_DATATYPE_DOUBLEH] = { 4, 4 },
+    [CANAS_DATATYPE_DOUBLEL] = { 4, 4 }
+};
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+
+// Network byte order is native here
+static inline void _copySwapped(void* pdst, const void* psrc, const MarshalDescriptor* pdesc)
+{
+    memcpy(pdst, psrc, pdesc->length);
 }
 
-#  define SWITCH(x) _switchByteOrder(&(x), sizeof(x))
-#endif
+#else
 
-#define MARSHAL_RESULT_ERROR -1
-#define MARSHAL_RESULT_UDEF  -2
+#  ifdef __GNUC__
+#    define BSWAP16(x) __builtin_bswap16(x)
+#    define BSWAP32(x) __builtin_bswap32(x)
+#  else
+#    define BSWAP16(x) ((uint16_t)(((x) >> 8) | ((x) << 8)))
+#    define BSWAP32(x) ((((x) >> 24) & 0xFFul) | (((x) >> 8) & 0xFF00ul) | \
+                        (((x) << 8) & 0xFF0000ul) | (((x) << 24) & 0xFF000000ul))
+#  endif
 
-static int _marshal(CanasMessageData* pmsg)
+static inline void _copySwapped(void* pdst, const void* psrc, const MarshalDescriptor* pdesc)
 {
-    switch (pmsg->type)
+    if (pdesc->swap_width == 4)
+    {
+        uint32_t x;
+        memcpy(&x, psrc, 4);
+        x = BSWAP32(x);
+        memcpy(pdst, &x, 4);
+    }
+    else if (pdesc->swap_width == 2 && pdesc->length == 2)
+    {
+        uint16_t x;
+        memcpy(&x, psrc, 2);
+        x = BSWAP16(x);
+        memcpy(pdst, &x, 2);
+    }
+    else if (pdesc->swap_width == 2)
     {
-    case CANAS_DATATYPE_NODATA:
-        return 0;
-
-    case CANAS_DATATYPE_FLOAT:
-        /*
-         * Target platform must support IEEE754 floats. The good news that almost every platform does that.
-         * But if some platform doesn't, proper converting from native float
-         * representation to IEEE754 (and vice versa) must be implemented somewhere here.
-         */
-        // FALLTHROUGH
-    case CANAS_DATATYPE_ERROR:
-    case CANAS_DATATYPE_LONG:
-    case CANAS_DATATYPE_ULONG:
-    case CANAS_DATATYPE_BLONG:
-        SWITCH(pmsg->container.ULONG);
-        return 4;
-
-    case CANAS_DATATYPE_SHORT:
-    case CANAS_DATATYPE_USHORT:
-    case CANAS_DATATYPE_BSHORT:
-        SWITCH(pmsg->container.USHORT);
-        return 2;
-
-    case CANAS_DATATYPE_CHAR:
-    case CANAS_DATATYPE_UCHAR:
-    case CANAS_DATATYPE_BCHAR:
-        return 1;
-
-    case CANAS_DATATYPE_SHORT2:
-    case CANAS_DATATYPE_USHORT2:
-    case CANAS_DATATYPE_BSHORT2:
-        SWITCH(pmsg->container.USHORT2[0]);
-        SWITCH(pmsg->container.USHORT2[1]);
-        return 4;
-
-    case CANAS_DATATYPE_CHAR4:
-    case CANAS_DATATYPE_UCHAR4:
-    case CANAS_DATATYPE_BCHAR4:
-        return 4;
-
-    case CANAS_DATATYPE_CHAR2:
-    case CANAS_DATATYPE_UCHAR2:
-    case CANAS_DATATYPE_BCHAR2:
-        return 2;
-
-    case CANAS_DATATYPE_MEMID:
-    case CANAS_DATATYPE_CHKSUM:
-        SWITCH(pmsg->container.MEMID);
-        return 4;
-
-    case CANAS_DATATYPE_ACHAR:
-        return 1;
-
-    case CANAS_DATATYPE_ACHAR2:
-        return 2;
-
-    case CANAS_DATATYPE_ACHAR4:
-        return 4;
-
-    case CANAS_DATATYPE_CHAR3:
-    case CANAS_DATATYPE_UCHAR3:
-    case CANAS_DATATYPE_BCHAR3:
-    case CANAS_DATATYPE_ACHAR3:
-        return 3;
-
-    case CANAS_DATATYPE_DOUBLEH:
-    case CANAS_DATATYPE_DOUBLEL:
-        // See note about IEEE754 compatibility above.
-        SWITCH(pmsg->container.DOUBLEL);
-        return 4;
-
-    default:
-        if (IS_UDEF(pmsg->type) && pmsg->length <= 4)
-            return MARSHAL_RESULT_UDEF;
-        CANAS_TRACE("marshal: unknown data type %02x, udf_len=%i\n", (int)pmsg->type, (int)pmsg->length);
-        return MARSHAL_RESULT_ERROR;
+        uint16_t x[2];
+        memcpy(x, psrc, 4);
+        x[0] = BSWAP16(x[0]);
+        x[1] = BSWAP16(x[1]);
+        memcpy(pdst, x, 4);
+    }
+    else
+    {
+        memcpy(pdst, psrc, pdesc->length);
     }
 }
 
+#endif
+
 int canasHostToNetwork(uint8_t* pdata, const CanasMessageData* phost)
 {
     if (pdata == NULL || phost == NULL)
         return -CANAS_ERR_ARGUMENT;
 
-    CanasMessageData nwk = *phost;
-    const int ret = _marshal(&nwk);
-    if (ret >= 0)
+    if (phost->type < CANAS_DATATYPE_RESVD_BEGIN_)
     {
-        memcpy(pdata, &nwk.container, ret);
-        return ret;
+        const MarshalDescriptor* pdesc = _descriptors + phost->type;
+        _copySwapped(pdata, &phost->container, pdesc);
+        return pdesc->length;
     }
-    if (ret == MARSHAL_RESULT_UDEF)
+    if (IS_UDEF(phost->type) && phost->length <= 4)
     {
-        memcpy(pdata, &nwk.container, nwk.length);
-        return nwk.length;
+        memcpy(pdata, &phost->container, phost->length);
+        return phost->length;
     }
+    CANAS_TRACE("marshal: unknown data type %02x, udf_len=%i\n", (int)phost->type, (int)phost->length);
     return -CANAS_ERR_BAD_DATA_TYPE;
 }
 
@@ -154,20 +151,25 @@ int canasNetworkToHost(CanasMessageData* phost, const uint8_t* pdata, uint8_t da
     if (datalen > 4)
         return -CANAS_ERR_BAD_DATA_TYPE;
 
-    memset(phost, 0, sizeof(*phost));
     phost->type = datatype;
     phost->length = datalen;             // For standard types this value should be ignored.
-    memcpy(&phost->container, pdata, datalen);
+    phost->container.ULONG = 0;
 
-    const int ret = _marshal(phost);
-    if (ret >= 0)
+    if (datatype < CANAS_DATATYPE_RESVD_BEGIN_)
     {
-        if (ret == datalen)
-            return ret;
-        CANAS_TRACE("marshal n2h: datalen mismatch: got %i, declared %i\n", (int)datalen, (int)ret);
-        return -CANAS_ERR_BAD_DATA_TYPE;
+        const MarshalDescriptor* pdesc = _descriptors + datatype;
+        if (pdesc->length != datalen)
+        {
+            CANAS_TRACE("marshal n2h: datalen mismatch: got %i, declared %i\n", (int)datalen, (int)pdesc->length);
+            return -CANAS_ERR_BAD_DATA_TYPE;
+        }
+        _copySwapped(&phost->container, pdata, pdesc);
+        return datalen;
     }
-    if (ret == MARSHAL_RESULT_UDEF)
+
+    memcpy(&phost->container, pdata, datalen);
+    if (IS_UDEF(datatype))
         return datalen;
+    CANAS_TRACE("marshal: unknown data type %02x, udf_len=%i\n", (int)datatype, (int)datalen);
     return -CANAS_ERR_BAD_DATA_TYPE;
 }
@@ -0,0 +1,40 @@
+/*
+ * Message ID classification table
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include "msgclass.h"
+
+/*
+ * The table is built by the preprocessor, so it goes into the read-only memory on embedded targets.
+ * Order of the ranges is defined by CanasMessageTypeID.
+ */
+#define P1    CANAS_MSGCLASS_PARAM
+#define P8    P1, P1, P1, P1, P1, P1, P1, P1
+#define P64   P8, P8, P8, P8, P8, P8, P8, P8
+#define P128  P64, P64
+#define P256  P128, P128
+#define P512  P256, P256
+#define P1024 P512, P512
+
+#define W1    CANAS_MSGCLASS_WTF
+#define W16   W1, W1, W1, W1, W1, W1, W1, W1, W1, W1, W1, W1, W1, W1, W1, W1
+
+#define S1(ch)  ((ch) << 1), (((ch) << 1) | 1)
+#define S4(ch)  S1(ch), S1((ch) + 1), S1((ch) + 2), S1((ch) + 3)
+#define S16(ch) S4(ch), S4((ch) + 4), S4((ch) + 8), S4((ch) + 12)
+#define S32(ch) S16(ch), S16((ch) + 16)
+
+const uint8_t canasMessageClassTable[] =
+{
+    P128,                                       // EMERGENCY_EVENT       0...127
+    S32(CANAS_SERVICE_CHANNEL_HIGH_MIN),        // NODE_SERVICE_HIGH   128...199
+    S4(CANAS_SERVICE_CHANNEL_HIGH_MIN + 32),
+    P1024, P512, P256, P8,                      // USER_DEFINED_HIGH, NORMAL_OPERATION, USER_DEFINED_LOW,
+                                                // DEBUG_SERVICE       200...1999
+    S16(CANAS_SERVICE_CHANNEL_LOW_MIN),         // NODE_SERVICE_LOW   2000...2031
+    W16                                         // Undefined          2032...2047
+};
+
+// If it fails here, the ranges above don't match the Message ID space
+typedef char _canas_msgclass_table_size_check[(sizeof(canasMessageClassTable) == CANAS_MSG_ID_COUNT) ? 1 : -1];
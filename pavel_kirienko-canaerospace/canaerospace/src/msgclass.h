@@ -0,0 +1,33 @@
+/*
+ * Message ID classification table
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#ifndef CANAEROSPACE_MSGCLASS_H_
+#define CANAEROSPACE_MSGCLASS_H_
+
+#include <stdint.h>
+#include <canaerospace/canaerospace.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Every entry is one of these, or a service entry encoded as (service_channel << 1) | is_response.
+ * Service channels never exceed 115, so the service entries can't collide with the special values.
+ */
+#define CANAS_MSGCLASS_WTF   0xFF
+#define CANAS_MSGCLASS_PARAM 0xFE
+
+extern const uint8_t canasMessageClassTable[CANAS_MSG_ID_COUNT];
+
+static inline uint8_t canasMessageClass(uint16_t msg_id)
+{
+    return (msg_id < CANAS_MSG_ID_COUNT) ? canasMessageClassTable[msg_id] : CANAS_MSGCLASS_WTF;
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif
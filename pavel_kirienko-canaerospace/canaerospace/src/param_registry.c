@@ -0,0 +1,202 @@
+/*
+ * Parameter metadata registry
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <canaerospace/param_registry.h>
+
+typedef enum
+{
+    FMT_NONE,
+    FMT_SIGNED,
+    FMT_UNSIGNED,
+    FMT_HEX,
+    FMT_FLOAT,
+    FMT_ASCII
+} ValueFormat;
+
+typedef struct
+{
+    uint8_t format;                ///< @ref ValueFormat
+    uint8_t count;                 ///< Number of scalars in the container
+    uint8_t width;                 ///< Size of each scalar
+} PrintDescriptor;
+
+static const PrintDescriptor _print_descriptors[CANAS_DATATYPE_RESVD_BEGIN_] =
+{
+    [CANAS_DATATYPE_NODATA]  = { FMT_NONE,     0, 0 },
+    [CANAS_DATATYPE_ERROR]   = { FMT_HEX,      1, 4 },
+
+    [CANAS_DATATYPE_FLOAT]   = { FMT_FLOAT,    1, 4 },
+
+    [CANAS_DATATYPE_LONG]    = { FMT_SIGNED,   1, 4 },
+    [CANAS_DATATYPE_ULONG]   = { FMT_UNSIGNED, 1, 4 },
+    [CANAS_DATATYPE_BLONG]   = { FMT_HEX,      1, 4 },
+
+    [CANAS_DATATYPE_SHORT]   = { FMT_SIGNED,   1, 2 },
+    [CANAS_DATATYPE_USHORT]  = { FMT_UNSIGNED, 1, 2 },
+    [CANAS_DATATYPE_BSHORT]  = { FMT_HEX,      1, 2 },
+
+    [CANAS_DATATYPE_CHAR]    = { FMT_SIGNED,   1, 1 },
+    [CANAS_DATATYPE_UCHAR]   = { FMT_UNSIGNED, 1, 1 },
+    [CANAS_DATATYPE_BCHAR]   = { FMT_HEX,      1, 1 },
+
+    [CANAS_DATATYPE_SHORT2]  = { FMT_SIGNED,   2, 2 },
+    [CANAS_DATATYPE_USHORT2] = { FMT_UNSIGNED, 2, 2 },
+    [CANAS_DATATYPE_BSHORT2] = { FMT_HEX,      2, 2 },
+
+    [CANAS_DATATYPE_CHAR4]   = { FMT_SIGNED,   4, 1 },
+    [CANAS_DATATYPE_UCHAR4]  = { FMT_UNSIGNED, 4, 1 },
+    [CANAS_DATATYPE_BCHAR4]  = { FMT_HEX,      4, 1 },
+
+    [CANAS_DATATYPE_CHAR2]   = { FMT_SIGNED,   2, 1 },
+    [CANAS_DATATYPE_UCHAR2]  = { FMT_UNSIGNED, 2, 1 },
+    [CANAS_DATATYPE_BCHAR2]  = { FMT_HEX,      2, 1 },
+
+    [CANAS_DATATYPE_MEMID]   = { FMT_HEX,      1, 4 },
+    [CANAS_DATATYPE_CHKSUM]  = { FMT_HEX,      1, 4 },
+
+    [CANAS_DATATYPE_ACHAR]   = { FMT_ASCII,    1, 1 },
+    [CANAS_DATATYPE_ACHAR2]  = { FMT_ASCII,    2, 1 },
+    [CANAS_DATATYPE_ACHAR4]  = { FMT_ASCII,    4, 1 },
+
+    [CANAS_DATATYPE_CHAR3]   = { FMT_SIGNED,   3, 1 },
+    [CANAS_DATATYPE_UCHAR3]  = { FMT_UNSIGNED, 3, 1 },
+    [CANAS_DATATYPE_BCHAR3]  = { FMT_HEX,      3, 1 },
+    [CANAS_DATATYPE_ACHAR3]  = { FMT_ASCII,    3, 1 },
+
+    [CANAS_DATATYPE_DOUBLEH] = { FMT_HEX,      1, 4 },
+    [CANAS_DATATYPE_DOUBLEL] = { FMT_HEX,      1, 4 }
+};
+
+const CanasParamMeta* canasParamMetaFind(const CanasParamRegistry* preg, uint16_t msg_id)
+{
+    if (preg == NULL)
+        return NULL;
+
+    int lo = 0, hi = (int)preg->num_entries - 1;
+    while (lo <= hi)
+    {
+        const int mid = (lo + hi) / 2;
+        const uint16_t mid_id = preg->pentries[mid].message_id;
+        if (mid_id == msg_id)
+            return preg->pentries + mid;
+        if (mid_id < msg_id)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
+    }
+    return NULL;
+}
+
+bool canasParamMetaTypeAllowed(const CanasParamMeta* pmeta, uint8_t datatype)
+{
+    return pmeta != NULL && datatype < 32 && (pmeta->type_mask & CANAS_PARAM_TYPE_BIT(datatype)) != 0;
+}
+
+static uint32_t _readScalar(const CanasDataContainer* pcont, int index, int width)
+{
+    if (width == 4)
+        return pcont->ULONG;
+    if (width == 2)
+        return pcont->USHORT2[index];
+    return pcont->UCHAR4[index];
+}
+
+static int32_t _signExtend(uint32_t value, int width)
+{
+    if (width == 2)
+        return (int16_t)value;
+    if (width == 1)
+        return (int8_t)value;
+    return (int32_t)value;
+}
+
+/**
+ * Output is truncated at the end of the buffer; the write position never goes past it.
+ */
+static void _append(char** pwpos, char* epos, const char* format, ...)
+{
+    if (*pwpos >= epos)
+        return;
+    va_list args;
+    va_start(args, format);
+    const int ret = vsnprintf(*pwpos, epos - *pwpos, format, args);
+    va_end(args);
+    if (ret > 0)
+        *pwpos = (ret < epos - *pwpos) ? (*pwpos + ret) : epos;
+}
+
+static void _printValue(char** pwpos, char* epos, const CanasMessageData* pdata)
+{
+    if (pdata->type >= CANAS_DATATYPE_RESVD_BEGIN_)        // Custom type, raw bytes
+    {
+        const int len = (pdata->length > 4) ? 4 : pdata->length;
+        _append(pwpos, epos, "udef%i", (int)pdata->type);
+        for (int i = 0; i < len; i++)
+            _append(pwpos, epos, " %02x", (unsigned int)pdata->container.UCHAR4[i]);
+        return;
+    }
+
+    const PrintDescriptor* pdesc = _print_descriptors + pdata->type;
+    if (pdesc->format == FMT_NONE)
+    {
+        _append(pwpos, epos, "-");
+    }
+    else if (pdesc->format == FMT_FLOAT)
+    {
+        _append(pwpos, epos, "%g", (double)pdata->container.FLOAT);
+    }
+    else if (pdesc->format == FMT_ASCII)
+    {
+        _append(pwpos, epos, "\'");
+        for (int i = 0; i < pdesc->count; i++)
+        {
+            uint8_t ch = pdata->container.ACHAR4[i];
+            if (ch < 0x20 || ch > 0x7E)
+                ch = '.';
+            _append(pwpos, epos, "%c", ch);
+        }
+        _append(pwpos, epos, "\'");
+    }
+    else
+    {
+        for (int i = 0; i < pdesc->count; i++)
+        {
+            const uint32_t value = _readScalar(&pdata->container, i, pdesc->width);
+            const char* sep = (i > 0) ? " " : "";
+            if (pdesc->format == FMT_SIGNED)
+                _append(pwpos, epos, "%s%li", sep, (long)_signExtend(value, pdesc->width));
+            else if (pdesc->format == FMT_UNSIGNED)
+                _append(pwpos, epos, "%s%lu", sep, (unsigned long)value);
+            else
+                _append(pwpos, epos, "%s0x%0*lx", sep, pdesc->width * 2, (unsigned long)value);
+        }
+    }
+}
+
+char* canasDumpParam(const CanasParamRegistry* preg, uint16_t msg_id, const CanasMessageData* pdata, char* pbuf)
+{
+    char* wpos = pbuf, *epos = pbuf + CANAS_DUMP_PARAM_BUF_LEN;
+    memset(pbuf, 0, CANAS_DUMP_PARAM_BUF_LEN);
+
+    const CanasParamMeta* pmeta = canasParamMetaFind(preg, msg_id);
+    if (pmeta != NULL)
+        _append(&wpos, epos, "%i %s = ", (int)msg_id, pmeta->name);
+    else
+        _append(&wpos, epos, "%i = ", (int)msg_id);
+
+    _printValue(&wpos, epos, pdata);
+
+    if (pmeta != NULL)
+    {
+        if (!canasParamMetaTypeAllowed(pmeta, pdata->type))
+            _append(&wpos, epos, " (bad data type %i)", (int)pdata->type);
+        else if (pmeta->units[0] != '\0')
+            _append(&wpos, epos, " %s", pmeta->units);
+    }
+    return pbuf;
+}
@@ -0,0 +1,552 @@
+/*
+ * Parameter registry for the default identifier distribution and the UAV extension
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+/*
+ * Generated by tools/gen_param_registry.py from nod_default.h, uav.h. Do not edit.
+ */
+
+#include <canaerospace/param_registry.h>
+
+#define T(x) CANAS_PARAM_TYPE_BIT(CANAS_DATATYPE_##x)
+
+static const CanasParamMeta _entries[] =
+{
+    {  200,   0, T(USHORT), "UAV_ESC_COMMAND_1", "" },
+    {  201,   0, T(USHORT), "UAV_ESC_COMMAND_2", "" },
+    {  202,   0, T(USHORT), "UAV_ESC_COMMAND_3", "" },
+    {  203,   0, T(USHORT), "UAV_ESC_COMMAND_4", "" },
+    {  204,   0, T(USHORT), "UAV_ESC_COMMAND_5", "" },
+    {  205,   0, T(USHORT), "UAV_ESC_COMMAND_6", "" },
+    {  206,   0, T(USHORT), "UAV_ESC_COMMAND_7", "" },
+    {  207,   0, T(USHORT), "UAV_ESC_COMMAND_8", "" },
+    {  300,   0, T(FLOAT) | T(SHORT2), "BODY_LONGITUDINAL_ACCELERATION", "g" },
+    {  301,   0, T(FLOAT) | T(SHORT2), "BODY_LATERAL_ACCELERATION", "g" },
+    {  302,   0, T(FLOAT) | T(SHORT2), "BODY_NORMAL_ACCELERATION", "g" },
+    {  303,   0, T(FLOAT) | T(SHORT2), "BODY_PITCH_RATE", "deg/s" },
+    {  304,   0, T(FLOAT) | T(SHORT2), "BODY_ROLL_RATE", "deg/s" },
+    {  305,   0, T(FLOAT) | T(SHORT2), "BODY_YAW_RATE", "deg/s" },
+    {  306,   0, T(FLOAT) | T(SHORT2), "RUDDER_POSITION", "deg" },
+    {  307,   0, T(FLOAT) | T(SHORT2), "STABILIZER_POSITION", "deg" },
+    {  308,   0, T(FLOAT) | T(SHORT2), "ELEVATOR_POSITION", "deg" },
+    {  309,   0, T(FLOAT) | T(SHORT2), "LEFT_AILERON_POSITION", "deg" },
+    {  310,   0, T(FLOAT) | T(SHORT2), "RIGHT_AILERON_POSITION", "deg" },
+    {  311,   0, T(FLOAT) | T(SHORT2), "BODY_PITCH_ANGLE", "deg" },
+    {  312,   0, T(FLOAT) | T(SHORT2), "BODY_ROLL_ANGLE", "deg" },
+    {  313,   0, T(FLOAT) | T(SHORT2), "BODY_SIDESLIP", "deg" },
+    {  314,   0, T(FLOAT) | T(SHORT2), "ALTITUDE_RATE", "m/s" },
+    {  315,   0, T(FLOAT) | T(SHORT2), "INDICATED_AIRSPEED", "m/s" },
+    {  316,   0, T(FLOAT) | T(SHORT2), "TRUE_AIRSPEED", "m/s" },
+    {  317,   0, T(FLOAT) | T(SHORT2), "CALIBRATED_AIRSPEED", "m/s" },
+    {  318,   0, T(FLOAT) | T(SHORT2), "MACH_NUMBER", "Mach" },
+    {  319,   0, T(FLOAT) | T(SHORT2), "BARO_CORRECTION", "hPa" },
+    {  320,   0, T(FLOAT) | T(SHORT2), "BARO_CORRECTED_ALTITUDE", "m" },
+    {  321,   0, T(FLOAT) | T(SHORT2), "HEADING_ANGLE", "deg" },
+    {  322,   0, T(FLOAT) | T(SHORT2), "STANDARD_ALTITUDE", "m" },
+    {  323,   0, T(FLOAT) | T(SHORT2), "TOTAL_AIR_TEMPERATURE", "K" },
+    {  324,   0, T(FLOAT) | T(SHORT2), "STATIC_AIR_TEMPERATURE", "K" },
+    {  325,   0, T(FLOAT) | T(SHORT2), "DIFFERENTIAL_PRESSURE", "hPa" },
+    {  326,   0, T(FLOAT) | T(SHORT2), "STATIC_PRESSURE", "hPa" },
+    {  327,   0, T(FLOAT) | T(SHORT2), "HEADING_RATE", "deg/s" },
+    {  328,   0, T(FLOAT) | T(SHORT2), "PORT_SIDE_ANGLE_OF_ATTACK", "deg" },
+    {  329,   0, T(FLOAT) | T(SHORT2), "STARBORD_SIDE_ANGLE_OF_ATTACK", "deg" },
+    {  330,   0, T(FLOAT) | T(SHORT2), "DENSITY_ALTITUDE", "m" },
+    {  331,   0, T(FLOAT) | T(SHORT2), "TURN_COORDINATION_RATE", "deg/s" },
+    {  332,   0, T(FLOAT) | T(SHORT2), "TRUE_ALTITUDE", "m" },
+    {  333,   0, T(FLOAT) | T(SHORT2), "WIND_SPEED", "m/s" },
+    {  334,   0, T(FLOAT) | T(SHORT2), "WIND_DIRECTION", "deg" },
+    {  335,   0, T(FLOAT) | T(SHORT2), "OUTSIDE_AIR_TEMPERATURE", "K" },
+    {  336,   0, T(FLOAT) | T(SHORT2), "BODY_NORMAL_VELOCITY", "m/s" },
+    {  337,   0, T(FLOAT) | T(SHORT2), "BODY_LONGITUDINAL_VELOCITY", "m/s" },
+    {  338,   0, T(FLOAT) | T(SHORT2), "BODY_LATERAL_VELOCITY", "m/s" },
+    {  339,   0, T(FLOAT) | T(SHORT2), "TOTAL_PRESSURE", "hPa" },
+    {  400,   0, T(FLOAT) | T(SHORT2), "PITCH_CONTROL_POSITION", "Norm -1/+1" },
+    {  401,   0, T(FLOAT) | T(SHORT2), "ROLL_CONTROL_POSITION", "Norm -1/+1" },
+    {  402,   0, T(FLOAT) | T(SHORT2), "LATERAL_STICK_TRIM_POSITION_COMMAND", "Norm -1/+1" },
+    {  403,   0, T(FLOAT) | T(SHORT2), "YAW_CONTROL_POSITION", "Norm -1/+1" },
+    {  404,   0, T(FLOAT) | T(SHORT2), "COLLECTIVE_CONTROL_POSITION", "Norm -1/+1" },
+    {  405,   0, T(FLOAT) | T(SHORT2), "LONGITUDINAL_STICK_TRIM_POSITION_COMMAND", "Norm -1/+1" },
+    {  406,   0, T(FLOAT) | T(SHORT2), "DIRECTIONAL_PEDALS_TRIM_POSITION_COMMAND", "Norm -1/+1" },
+    {  407,   0, T(FLOAT) | T(SHORT2), "COLLECTIVE_LEVER_TRIM_POSITION_COMMAND", "Norm -1/+1" },
+    {  408,   0, T(BLONG) | T(BSHORT), "CYCLIC_CONTROL_STICK_SWITCHES", "" },
+    {  409,   0, T(FLOAT) | T(SHORT2), "LATERAL_TRIM_SPEED", "Norm -1/+1" },
+    {  410,   0, T(FLOAT) | T(SHORT2), "LONGITUDINAL_TRIM_SPEED", "Norm -1/+1" },
+    {  411,   0, T(FLOAT) | T(SHORT2), "PEDAL_TRIM_SPEED", "Norm -1/+1" },
+    {  412,   0, T(FLOAT) | T(SHORT2), "COLLECTIVE_TRIM_SPEED", "Norm -1/+1" },
+    {  413,   0, T(FLOAT) | T(SHORT2), "NOSE_WHEEL_STEERING_HANDLE_POSITION", "Norm -1/+1" },
+    {  414,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_THROTTLE_LEVER_POSITION_ECS_CHANNEL_A", "Norm -1/+1" },
+    {  415,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_THROTTLE_LEVER_POSITION_ECS_CHANNEL_A", "Norm -1/+1" },
+    {  416,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_THROTTLE_LEVER_POSITION_ECS_CHANNEL_A", "Norm -1/+1" },
+    {  417,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_THROTTLE_LEVER_POSITION_ECS_CHANNEL_A", "Norm -1/+1" },
+    {  418,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_CONDITION_LEVER_POSITION_ECS_CHANNEL_A", "Norm -1/+1" },
+    {  419,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_CONDITION_LEVER_POSITION_ECS_CHANNEL_A", "Norm -1/+1" },
+    {  420,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_CONDITION_LEVER_POSITION_ECS_CHANNEL_A", "Norm -1/+1" },
+    {  421,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_CONDITION_LEVER_POSITION_ECS_CHANNEL_A", "Norm -1/+1" },
+    {  422,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_THROTTLE_LEVER_POSITION_ECS_CHANNEL_B", "Norm -1/+1" },
+    {  423,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_THROTTLE_LEVER_POSITION_ECS_CHANNEL_B", "Norm -1/+1" },
+    {  424,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_THROTTLE_LEVER_POSITION_ECS_CHANNEL_B", "Norm -1/+1" },
+    {  425,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_THROTTLE_LEVER_POSITION_ECS_CHANNEL_B", "Norm -1/+1" },
+    {  426,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_CONDITION_LEVER_POSITION_ECS_CHANNEL_B", "Norm -1/+1" },
+    {  427,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_CONDITION_LEVER_POSITION_ECS_CHANNEL_B", "Norm -1/+1" },
+    {  428,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_CONDITION_LEVER_POSITION_ECS_CHANNEL_B", "Norm -1/+1" },
+    {  429,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_CONDITION_LEVER_POSITION_ECS_CHANNEL_B", "Norm -1/+1" },
+    {  430,   0, T(FLOAT) | T(SHORT2), "FLAPS_LEVER_POSITION", "Norm -1/+1" },
+    {  431,   0, T(FLOAT) | T(SHORT2), "SLATS_LEVER_POSITION", "Norm -1/+1" },
+    {  432,   0, T(FLOAT) | T(SHORT2), "PARK_BRAKE_LEVER_POSITION", "Norm -1/+1" },
+    {  433,   0, T(FLOAT) | T(SHORT2), "SPEEDBRAKE_LEVER_POSITION", "Norm -1/+1" },
+    {  434,   0, T(FLOAT) | T(SHORT2), "THROTTLE_MAX_LEVER_POSITION", "Norm -1/+1" },
+    {  435,   0, T(FLOAT) | T(SHORT2), "PILOT_LEFT_BRAKE_PEDAL_POSITION", "Norm -1/+1" },
+    {  436,   0, T(FLOAT) | T(SHORT2), "PILOT_RIGHT_BRAKE_PEDAL_POSITION", "Norm -1/+1" },
+    {  437,   0, T(FLOAT) | T(SHORT2), "COPILOT_LEFT_BRAKE_PEDAL_POSITION", "Norm -1/+1" },
+    {  438,   0, T(FLOAT) | T(SHORT2), "COPILOT_RIGHT_BRAKE_PEDAL_POSITION", "Norm -1/+1" },
+    {  439,   0, T(BLONG) | T(BSHORT), "TRIM_SYSTEM_SWITCHES", "" },
+    {  440,   0, T(BLONG) | T(BSHORT), "TRIM_SYSTEM_LIGHTS", "" },
+    {  441,   0, T(BLONG) | T(BSHORT), "COLLECTIVE_CONTROL_STICK_SWITCHES", "" },
+    {  442,   0, T(BLONG) | T(BSHORT), "STICK_SHAKER_STALL_WARNING_DEVICE", "" },
+    {  500,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_N1_ECS_CHANNEL_A", "1/min" },
+    {  501,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_N1_ECS_CHANNEL_A", "1/min" },
+    {  502,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_N1_ECS_CHANNEL_A", "1/min" },
+    {  503,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_N1_ECS_CHANNEL_A", "1/min" },
+    {  504,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_N2_ECS_CHANNEL_A", "1/min" },
+    {  505,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_N2_ECS_CHANNEL_A", "1/min" },
+    {  506,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_N2_ECS_CHANNEL_A", "1/min" },
+    {  507,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_N2_ECS_CHANNEL_A", "1/min" },
+    {  508,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_TORQUE_ECS_CHANNEL_A", "Norm -1/+1" },
+    {  509,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_TORQUE_ECS_CHANNEL_A", "Norm -1/+1" },
+    {  510,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_TORQUE_ECS_CHANNEL_A", "Norm -1/+1" },
+    {  511,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_TORQUE_ECS_CHANNEL_A", "Norm -1/+1" },
+    {  512,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_TURBINE_INLET_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  513,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_TURBINE_INLET_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  514,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_TURBINE_INLET_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  515,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_TURBINE_INLET_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  516,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_INTER_TURBINE_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  517,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_INTER_TURBINE_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  518,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_INTER_TURBINE_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  519,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_INTER_TURBINE_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  520,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_TURBINE_OUTLET_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  521,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_TURBINE_OUTLET_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  522,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_TURBINE_OUTLET_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  523,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_TURBINE_OUTLET_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  524,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_FUEL_FLOW_RATE_ECS_CHANNEL_A", "l/h" },
+    {  525,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_FUEL_FLOW_RATE_ECS_CHANNEL_A", "l/h" },
+    {  526,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_FUEL_FLOW_RATE_ECS_CHANNEL_A", "l/h" },
+    {  527,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_FUEL_FLOW_RATE_ECS_CHANNEL_A", "l/h" },
+    {  528,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_MANIFOLD_PRESSURE_ECS_CHANNEL_A", "hPa" },
+    {  529,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_MANIFOLD_PRESSURE_ECS_CHANNEL_A", "hPa" },
+    {  530,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_MANIFOLD_PRESSURE_ECS_CHANNEL_A", "hPa" },
+    {  531,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_MANIFOLD_PRESSURE_ECS_CHANNEL_A", "hPa" },
+    {  532,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_OIL_PRESSURE_ECS_CHANNEL_A", "hPa" },
+    {  533,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_OIL_PRESSURE_ECS_CHANNEL_A", "hPa" },
+    {  534,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_OIL_PRESSURE_ECS_CHANNEL_A", "hPa" },
+    {  535,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_OIL_PRESSURE_ECS_CHANNEL_A", "hPa" },
+    {  536,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_OIL_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  537,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_OIL_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  538,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_OIL_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  539,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_OIL_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  540,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_CYLINDER_HEAD_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  541,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_CYLINDER_HEAD_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  542,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_CYLINDER_HEAD_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  543,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_CYLINDER_HEAD_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  544,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_OIL_QUANTITY_ECS_CHANNEL_A", "l" },
+    {  545,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_OIL_QUANTITY_ECS_CHANNEL_A", "l" },
+    {  546,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_OIL_QUANTITY_ECS_CHANNEL_A", "l" },
+    {  547,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_OIL_QUANTITY_ECS_CHANNEL_A", "l" },
+    {  548,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_COOLAND_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  549,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_COOLAND_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  550,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_COOLAND_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  551,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_COOLAND_TEMPERATURE_ECS_CHANNEL_A", "K" },
+    {  552,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_POWER_RATING_ECS_CHANNEL_A", "Norm -1/+1" },
+    {  553,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_POWER_RATING_ECS_CHANNEL_A", "Norm -1/+1" },
+    {  554,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_POWER_RATING_ECS_CHANNEL_A", "Norm -1/+1" },
+    {  555,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_POWER_RATING_ECS_CHANNEL_A", "Norm -1/+1" },
+    {  556,   0, T(BSHORT) | T(BLONG), "ENGINE_1_STATUS_1_ECS_CHANNEL_A", "" },
+    {  557,   0, T(BSHORT) | T(BLONG), "ENGINE_2_STATUS_1_ECS_CHANNEL_A", "" },
+    {  558,   0, T(BSHORT) | T(BLONG), "ENGINE_3_STATUS_1_ECS_CHANNEL_A", "" },
+    {  559,   0, T(BSHORT) | T(BLONG), "ENGINE_4_STATUS_1_ECS_CHANNEL_A", "" },
+    {  560,   0, T(BSHORT) | T(BLONG), "ENGINE_1_STATUS_2_ECS_CHANNEL_A", "" },
+    {  561,   0, T(BSHORT) | T(BLONG), "ENGINE_2_STATUS_2_ECS_CHANNEL_A", "" },
+    {  562,   0, T(BSHORT) | T(BLONG), "ENGINE_3_STATUS_2_ECS_CHANNEL_A", "" },
+    {  563,   0, T(BSHORT) | T(BLONG), "ENGINE_4_STATUS_2_ECS_CHANNEL_A", "" },
+    {  564,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_N1_ECS_CHANNEL_B", "1/min" },
+    {  565,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_N1_ECS_CHANNEL_B", "1/min" },
+    {  566,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_N1_ECS_CHANNEL_B", "1/min" },
+    {  567,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_N1_ECS_CHANNEL_B", "1/min" },
+    {  568,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_N2_ECS_CHANNEL_B", "1/min" },
+    {  569,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_N2_ECS_CHANNEL_B", "1/min" },
+    {  570,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_N2_ECS_CHANNEL_B", "1/min" },
+    {  571,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_N2_ECS_CHANNEL_B", "1/min" },
+    {  572,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_TORQUE_ECS_CHANNEL_B", "Norm -1/+1" },
+    {  573,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_TORQUE_ECS_CHANNEL_B", "Norm -1/+1" },
+    {  574,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_TORQUE_ECS_CHANNEL_B", "Norm -1/+1" },
+    {  575,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_TORQUE_ECS_CHANNEL_B", "Norm -1/+1" },
+    {  576,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_TURBINE_INLET_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  577,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_TURBINE_INLET_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  578,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_TURBINE_INLET_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  579,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_TURBINE_INLET_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  580,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_INTER_TURBINE_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  581,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_INTER_TURBINE_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  582,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_INTER_TURBINE_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  583,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_INTER_TURBINE_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  584,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_TURBINE_OUTLET_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  585,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_TURBINE_OUTLET_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  586,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_TURBINE_OUTLET_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  587,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_TURBINE_OUTLET_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  588,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_FUEL_FLOW_RATE_ECS_CHANNEL_B", "l/h" },
+    {  589,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_FUEL_FLOW_RATE_ECS_CHANNEL_B", "l/h" },
+    {  590,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_FUEL_FLOW_RATE_ECS_CHANNEL_B", "l/h" },
+    {  591,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_FUEL_FLOW_RATE_ECS_CHANNEL_B", "l/h" },
+    {  592,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_MANIFOLD_PRESSURE_ECS_CHANNEL_B", "hPa" },
+    {  593,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_MANIFOLD_PRESSURE_ECS_CHANNEL_B", "hPa" },
+    {  594,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_MANIFOLD_PRESSURE_ECS_CHANNEL_B", "hPa" },
+    {  595,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_MANIFOLD_PRESSURE_ECS_CHANNEL_B", "hPa" },
+    {  596,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_OIL_PRESSURE_ECS_CHANNEL_B", "hPa" },
+    {  597,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_OIL_PRESSURE_ECS_CHANNEL_B", "hPa" },
+    {  598,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_OIL_PRESSURE_ECS_CHANNEL_B", "hPa" },
+    {  599,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_OIL_PRESSURE_ECS_CHANNEL_B", "hPa" },
+    {  600,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_OIL_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  601,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_OIL_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  602,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_OIL_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  603,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_OIL_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  604,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_CYLINDER_HEAD_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  605,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_CYLINDER_HEAD_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  606,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_CYLINDER_HEAD_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  607,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_CYLINDER_HEAD_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  608,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_OIL_QUANTITY_ECS_CHANNEL_B", "l" },
+    {  609,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_OIL_QUANTITY_ECS_CHANNEL_B", "l" },
+    {  610,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_OIL_QUANTITY_ECS_CHANNEL_B", "l" },
+    {  611,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_OIL_QUANTITY_ECS_CHANNEL_B", "l" },
+    {  612,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_COOLANT_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  613,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_COOLANT_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  614,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_COOLANT_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  615,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_COOLANT_TEMPERATURE_ECS_CHANNEL_B", "K" },
+    {  616,   0, T(FLOAT) | T(SHORT2), "ENGINE_1_POWER_RATING_ECS_CHANNEL_B", "Norm -1/+1" },
+    {  617,   0, T(FLOAT) | T(SHORT2), "ENGINE_2_POWER_RATING_ECS_CHANNEL_B", "Norm -1/+1" },
+    {  618,   0, T(FLOAT) | T(SHORT2), "ENGINE_3_POWER_RATING_ECS_CHANNEL_B", "Norm -1/+1" },
+    {  619,   0, T(FLOAT) | T(SHORT2), "ENGINE_4_POWER_RATING_ECS_CHANNEL_B", "Norm -1/+1" },
+    {  620,   0, T(BSHORT) | T(BLONG), "ENGINE_1_STATUS_1_ECS_CHANNEL_B", "" },
+    {  621,   0, T(BSHORT) | T(BLONG), "ENGINE_2_STATUS_1_ECS_CHANNEL_B", "" },
+    {  622,   0, T(BSHORT) | T(BLONG), "ENGINE_3_STATUS_1_ECS_CHANNEL_B", "" },
+    {  623,   0, T(BSHORT) | T(BLONG), "ENGINE_4_STATUS_1_ECS_CHANNEL_B", "" },
+    {  624,   0, T(BSHORT) | T(BLONG), "ENGINE_1_STATUS_2_ECS_CHANNEL_B", "" },
+    {  625,   0, T(BSHORT) | T(BLONG), "ENGINE_2_STATUS_2_ECS_CHANNEL_B", "" },
+    {  626,   0, T(BSHORT) | T(BLONG), "ENGINE_3_STATUS_2_ECS_CHANNEL_B", "" },
+    {  627,   0, T(BSHORT) | T(BLONG), "ENGINE_4_STATUS_2_ECS_CHANNEL_B", "" },
+    {  660,   0, T(FLOAT) | T(SHORT2), "FUEL_PUMP_1_FLOW_RATE", "l/h" },
+    {  661,   0, T(FLOAT) | T(SHORT2), "FUEL_PUMP_2_FLOW_RATE", "l/h" },
+    {  662,   0, T(FLOAT) | T(SHORT2), "FUEL_PUMP_3_FLOW_RATE", "l/h" },
+    {  663,   0, T(FLOAT) | T(SHORT2), "FUEL_PUMP_4_FLOW_RATE", "l/h" },
+    {  664,   0, T(FLOAT) | T(SHORT2), "FUEL_PUMP_5_FLOW_RATE", "l/h" },
+    {  665,   0, T(FLOAT) | T(SHORT2), "FUEL_PUMP_6_FLOW_RATE", "l/h" },
+    {  666,   0, T(FLOAT) | T(SHORT2), "FUEL_PUMP_7_FLOW_RATE", "l/h" },
+    {  667,   0, T(FLOAT) | T(SHORT2), "FUEL_PUMP_8_FLOW_RATE", "l/h" },
+    {  668,   0, T(FLOAT) | T(SHORT2), "FUEL_TANK_1_QUANTITY", "kg" },
+    {  669,   0, T(FLOAT) | T(SHORT2), "FUEL_TANK_2_QUANTITY", "kg" },
+    {  670,   0, T(FLOAT) | T(SHORT2), "FUEL_TANK_3_QUANTITY", "kg" },
+    {  671,   0, T(FLOAT) | T(SHORT2), "FUEL_TANK_4_QUANTITY", "kg" },
+    {  672,   0, T(FLOAT) | T(SHORT2), "FUEL_TANK_5_QUANTITY", "kg" },
+    {  673,   0, T(FLOAT) | T(SHORT2), "FUEL_TANK_6_QUANTITY", "kg" },
+    {  674,   0, T(FLOAT) | T(SHORT2), "FUEL_TANK_7_QUANTITY", "kg" },
+    {  675,   0, T(FLOAT) | T(SHORT2), "FUEL_TANK_8_QUANTITY", "kg" },
+    {  676,   0, T(FLOAT) | T(SHORT2), "FUEL_TANK_1_TEMPERATURE", "K" },
+    {  677,   0, T(FLOAT) | T(SHORT2), "FUEL_TANK_2_TEMPERATURE", "K" },
+    {  678,   0, T(FLOAT) | T(SHORT2), "FUEL_TANK_3_TEMPERATURE", "K" },
+    {  679,   0, T(FLOAT) | T(SHORT2), "FUEL_TANK_4_TEMPERATURE", "K" },
+    {  680,   0, T(FLOAT) | T(SHORT2), "FUEL_TANK_5_TEMPERATURE", "K" },
+    {  681,   0, T(FLOAT) | T(SHORT2), "FUEL_TANK_6_TEMPERATURE", "K" },
+    {  682,   0, T(FLOAT) | T(SHORT2), "FUEL_TANK_7_TEMPERATURE", "K" },
+    {  683,   0, T(FLOAT) | T(SHORT2), "FUEL_TANK_8_TEMPERATURE", "K" },
+    {  684,   0, T(FLOAT) | T(SHORT2), "FUEL_SYSTEM_1_PRESSURE", "hPa" },
+    {  685,   0, T(FLOAT) | T(SHORT2), "FUEL_SYSTEM_2_PRESSURE", "hPa" },
+    {  686,   0, T(FLOAT) | T(SHORT2), "FUEL_SYSTEM_3_PRESSURE", "hPa" },
+    {  687,   0, T(FLOAT) | T(SHORT2), "FUEL_SYSTEM_4_PRESSURE", "hPa" },
+    {  688,   0, T(FLOAT) | T(SHORT2), "FUEL_SYSTEM_5_PRESSURE", "hPa" },
+    {  689,   0, T(FLOAT) | T(SHORT2), "FUEL_SYSTEM_6_PRESSURE", "hPa" },
+    {  690,   0, T(FLOAT) | T(SHORT2), "FUEL_SYSTEM_7_PRESSURE", "hPa" },
+    {  691,   0, T(FLOAT) | T(SHORT2), "FUEL_SYSTEM_8_PRESSURE", "hPa" },
+    {  700,   0, T(FLOAT) | T(SHORT2), "ROTOR_1_RPM", "1/min" },
+    {  701,   0, T(FLOAT) | T(SHORT2), "ROTOR_2_RPM", "1/min" },
+    {  702,   0, T(FLOAT) | T(SHORT2), "ROTOR_3_RPM", "1/min" },
+    {  703,   0, T(FLOAT) | T(SHORT2), "ROTOR_4_RPM", "1/min" },
+    {  704,   0, T(FLOAT) | T(SHORT2), "GEARBOX_1_SPEED", "1/min" },
+    {  705,   0, T(FLOAT) | T(SHORT2), "GEARBOX_2_SPEED", "1/min" },
+    {  706,   0, T(FLOAT) | T(SHORT2), "GEARBOX_3_SPEED", "1/min" },
+    {  707,   0, T(FLOAT) | T(SHORT2), "GEARBOX_4_SPEED", "1/min" },
+    {  708,   0, T(FLOAT) | T(SHORT2), "GEARBOX_5_SPEED", "1/min" },
+    {  709,   0, T(FLOAT) | T(SHORT2), "GEARBOX_6_SPEED", "1/min" },
+    {  710,   0, T(FLOAT) | T(SHORT2), "GEARBOX_7_SPEED", "1/min" },
+    {  711,   0, T(FLOAT) | T(SHORT2), "GEARBOX_8_SPEED", "1/min" },
+    {  712,   0, T(FLOAT) | T(SHORT2), "GEARBOX_1_OIL_PRESSURE", "hPa" },
+    {  713,   0, T(FLOAT) | T(SHORT2), "GEARBOX_2_OIL_PRESSURE", "hPa" },
+    {  714,   0, T(FLOAT) | T(SHORT2), "GEARBOX_3_OIL_PRESSURE", "hPa" },
+    {  715,   0, T(FLOAT) | T(SHORT2), "GEARBOX_4_OIL_PRESSURE", "hPa" },
+    {  716,   0, T(FLOAT) | T(SHORT2), "GEARBOX_5_OIL_PRESSURE", "hPa" },
+    {  717,   0, T(FLOAT) | T(SHORT2), "GEARBOX_6_OIL_PRESSURE", "hPa" },
+    {  718,   0, T(FLOAT) | T(SHORT2), "GEARBOX_7_OIL_PRESSURE", "hPa" },
+    {  719,   0, T(FLOAT) | T(SHORT2), "GEARBOX_8_OIL_PRESSURE", "hPa" },
+    {  720,   0, T(FLOAT) | T(SHORT2), "GEARBOX_1_OIL_TEMPERATURE", "K" },
+    {  721,   0, T(FLOAT) | T(SHORT2), "GEARBOX_2_OIL_TEMPERATURE", "K" },
+    {  722,   0, T(FLOAT) | T(SHORT2), "GEARBOX_3_OIL_TEMPERATURE", "K" },
+    {  723,   0, T(FLOAT) | T(SHORT2), "GEARBOX_4_OIL_TEMPERATURE", "K" },
+    {  724,   0, T(FLOAT) | T(SHORT2), "GEARBOX_5_OIL_TEMPERATURE", "K" },
+    {  725,   0, T(FLOAT) | T(SHORT2), "GEARBOX_6_OIL_TEMPERATURE", "K" },
+    {  726,   0, T(FLOAT) | T(SHORT2), "GEARBOX_7_OIL_TEMPERATURE", "K" },
+    {  727,   0, T(FLOAT) | T(SHORT2), "GEARBOX_8_OIL_TEMPERATURE", "K" },
+    {  728,   0, T(FLOAT) | T(SHORT2), "GEARBOX_1_OIL_QUANTITY", "l" },
+    {  729,   0, T(FLOAT) | T(SHORT2), "GEARBOX_2_OIL_QUANTITY", "l" },
+    {  730,   0, T(FLOAT) | T(SHORT2), "GEARBOX_3_OIL_QUANTITY", "l" },
+    {  731,   0, T(FLOAT) | T(SHORT2), "GEARBOX_4_OIL_QUANTITY", "l" },
+    {  732,   0, T(FLOAT) | T(SHORT2), "GEARBOX_5_OIL_QUANTITY", "l" },
+    {  733,   0, T(FLOAT) | T(SHORT2), "GEARBOX_6_OIL_QUANTITY", "l" },
+    {  734,   0, T(FLOAT) | T(SHORT2), "GEARBOX_7_OIL_QUANTITY", "l" },
+    {  735,   0, T(FLOAT) | T(SHORT2), "GEARBOX_8_OIL_QUANTITY", "l" },
+    {  800,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_1_PRESSURE", "hPa" },
+    {  801,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_2_PRESSURE", "hPa" },
+    {  802,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_3_PRESSURE", "hPa" },
+    {  803,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_4_PRESSURE", "hPa" },
+    {  804,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_5_PRESSURE", "hPa" },
+    {  805,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_6_PRESSURE", "hPa" },
+    {  806,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_7_PRESSURE", "hPa" },
+    {  807,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_8_PRESSURE", "hPa" },
+    {  808,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_1_FLUID_TEMPERATURE", "K" },
+    {  809,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_2_FLUID_TEMPERATURE", "K" },
+    {  810,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_3_FLUID_TEMPERATURE", "K" },
+    {  811,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_4_FLUID_TEMPERATURE", "K" },
+    {  812,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_5_FLUID_TEMPERATURE", "K" },
+    {  813,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_6_FLUID_TEMPERATURE", "K" },
+    {  814,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_7_FLUID_TEMPERATURE", "K" },
+    {  815,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_8_FLUID_TEMPERATURE", "K" },
+    {  816,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_1_FLUID_QUANTITY", "l" },
+    {  817,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_2_FLUID_QUANTITY", "l" },
+    {  818,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_3_FLUID_QUANTITY", "l" },
+    {  819,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_4_FLUID_QUANTITY", "l" },
+    {  820,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_5_FLUID_QUANTITY", "l" },
+    {  821,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_6_FLUID_QUANTITY", "l" },
+    {  822,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_7_FLUID_QUANTITY", "l" },
+    {  823,   0, T(FLOAT) | T(SHORT2), "HYDRAULIC_SYSTEM_8_FLUID_QUANTITY", "l" },
+    {  900,   0, T(FLOAT) | T(SHORT2), "AC_SYSTEM_1_VOLTAGE", "volt" },
+    {  901,   0, T(FLOAT) | T(SHORT2), "AC_SYSTEM_2_VOLTAGE", "volt" },
+    {  902,   0, T(FLOAT) | T(SHORT2), "AC_SYSTEM_3_VOLTAGE", "volt" },
+    {  903,   0, T(FLOAT) | T(SHORT2), "AC_SYSTEM_4_VOLTAGE", "volt" },
+    {  904,   0, T(FLOAT) | T(SHORT2), "AC_SYSTEM_5_VOLTAGE", "volt" },
+    {  905,   0, T(FLOAT) | T(SHORT2), "AC_SYSTEM_6_VOLTAGE", "volt" },
+    {  906,   0, T(FLOAT) | T(SHORT2), "AC_SYSTEM_7_VOLTAGE", "volt" },
+    {  907,   0, T(FLOAT) | T(SHORT2), "AC_SYSTEM_8_VOLTAGE", "volt" },
+    {  908,   0, T(FLOAT) | T(SHORT2), "AC_SYSTEM_9_VOLTAGE", "volt" },
+    {  909,   0, T(FLOAT) | T(SHORT2), "AC_SYSTEM_10_VOLTAGE", "volt" },
+    {  910,   0, T(FLOAT) | T(SHORT2), "AC_SYSTEM_1_CURRENT", "ampere" },
+    {  911,   0, T(FLOAT) | T(SHORT2), "AC_SYSTEM_2_CURRENT", "ampere" },
+    {  912,   0, T(FLOAT) | T(SHORT2), "AC_SYSTEM_3_CURRENT", "ampere" },
+    {  913,   0, T(FLOAT) | T(SHORT2), "AC_SYSTEM_4_CURRENT", "ampere" },
+    {  914,   0, T(FLOAT) | T(SHORT2), "AC_SYSTEM_5_CURRENT", "ampere" },
+    {  915,   0, T(FLOAT) | T(SHORT2), "AC_SYSTEM_6_CURRENT", "ampere" },
+    {  916,   0, T(FLOAT) | T(SHORT2), "AC_SYSTEM_7_CURRENT", "ampere" },
+    {  917,   0, T(FLOAT) | T(SHORT2), "AC_SYSTEM_8_CURRENT", "ampere" },
+    {  918,   0, T(FLOAT) | T(SHORT2), "AC_SYSTEM_9_CURRENT", "ampere" },
+    {  919,   0, T(FLOAT) | T(SHORT2), "AC_SYSTEM_10_CURRENT", "ampere" },
+    {  920,   0, T(FLOAT) | T(SHORT2), "DC_SYSTEM_1_VOLTAGE", "volt" },
+    {  921,   0, T(FLOAT) | T(SHORT2), "DC_SYSTEM_2_VOLTAGE", "volt" },
+    {  922,   0, T(FLOAT) | T(SHORT2), "DC_SYSTEM_3_VOLTAGE", "volt" },
+    {  923,   0, T(FLOAT) | T(SHORT2), "DC_SYSTEM_4_VOLTAGE", "volt" },
+    {  924,   0, T(FLOAT) | T(SHORT2), "DC_SYSTEM_5_VOLTAGE", "volt" },
+    {  925,   0, T(FLOAT) | T(SHORT2), "DC_SYSTEM_6_VOLTAGE", "volt" },
+    {  926,   0, T(FLOAT) | T(SHORT2), "DC_SYSTEM_7_VOLTAGE", "volt" },
+    {  927,   0, T(FLOAT) | T(SHORT2), "DC_SYSTEM_8_VOLTAGE", "volt" },
+    {  928,   0, T(FLOAT) | T(SHORT2), "DC_SYSTEM_9_VOLTAGE", "volt" },
+    {  929,   0, T(FLOAT) | T(SHORT2), "DC_SYSTEM_10_VOLTAGE", "volt" },
+    {  930,   0, T(FLOAT) | T(SHORT2), "DC_SYSTEM_1_CURRENT", "ampere" },
+    {  931,   0, T(FLOAT) | T(SHORT2), "DC_SYSTEM_2_CURRENT", "ampere" },
+    {  932,   0, T(FLOAT) | T(SHORT2), "DC_SYSTEM_3_CURRENT", "ampere" },
+    {  933,   0, T(FLOAT) | T(SHORT2), "DC_SYSTEM_4_CURRENT", "ampere" },
+    {  934,   0, T(FLOAT) | T(SHORT2), "DC_SYSTEM_5_CURRENT", "ampere" },
+    {  935,   0, T(FLOAT) | T(SHORT2), "DC_SYSTEM_6_CURRENT", "ampere" },
+    {  936,   0, T(FLOAT) | T(SHORT2), "DC_SYSTEM_7_CURRENT", "ampere" },
+    {  937,   0, T(FLOAT) | T(SHORT2), "DC_SYSTEM_8_CURRENT", "ampere" },
+    {  938,   0, T(FLOAT) | T(SHORT2), "DC_SYSTEM_9_CURRENT", "ampere" },
+    {  939,   0, T(FLOAT) | T(SHORT2), "DC_SYSTEM_10_CURRENT", "ampere" },
+    {  940,   0, T(FLOAT) | T(SHORT2), "PROP_1_ICEGUARD_DC_CURRENT", "ampere" },
+    {  941,   0, T(FLOAT) | T(SHORT2), "PROP_2_ICEGUARD_DC_CURRENT", "ampere" },
+    {  942,   0, T(FLOAT) | T(SHORT2), "PROP_3_ICEGUARD_DC_CURRENT", "ampere" },
+    {  943,   0, T(FLOAT) | T(SHORT2), "PROP_4_ICEGUARD_DC_CURRENT", "ampere" },
+    {  944,   0, T(FLOAT) | T(SHORT2), "PROP_5_ICEGUARD_DC_CURRENT", "ampere" },
+    {  945,   0, T(FLOAT) | T(SHORT2), "PROP_6_ICEGUARD_DC_CURRENT", "ampere" },
+    {  946,   0, T(FLOAT) | T(SHORT2), "PROP_7_ICEGUARD_DC_CURRENT", "ampere" },
+    {  947,   0, T(FLOAT) | T(SHORT2), "PROP_8_ICEGUARD_DC_CURRENT", "ampere" },
+    {  948,   0, T(FLOAT) | T(SHORT2), "PROP_9_ICEGUARD_DC_CURRENT", "ampere" },
+    {  949,   0, T(FLOAT) | T(SHORT2), "PROP_10_ICEGUARD_DC_CURRENT", "ampere" },
+    { 1000,   0, T(FLOAT) | T(SHORT2), "ACTIVE_NAV_SYSTEM_WAYPOINT_LATITUDE", "deg" },
+    { 1001,   0, T(FLOAT) | T(SHORT), "ACTIVE_NAV_SYSTEM_WAYPOINT_LONGITUDE", "deg" },
+    { 1002,   0, T(FLOAT) | T(SHORT2), "ACTIVE_NAV_SYSTEM_WAYPOINT_HEIGHT_ABOVE_ELLIPSOID", "m" },
+    { 1003,   0, T(FLOAT) | T(SHORT2), "ACTIVE_NAV_SYSTEM_WAYPOINT_ALTITUDE", "m" },
+    { 1004,   0, T(FLOAT) | T(SHORT2), "ACTIVE_NAV_SYSTEM_GROUND_SPEED", "m/s" },
+    { 1005,   0, T(FLOAT) | T(SHORT2), "ACTIVE_NAV_SYSTEM_TRUE_TRACK", "deg" },
+    { 1006,   0, T(FLOAT) | T(SHORT2), "ACTIVE_NAV_SYSTEM_MAGNETIC_TRACK", "deg" },
+    { 1007,   0, T(FLOAT) | T(SHORT2), "ACTIVE_NAV_SYSTEM_CROSS_TRACK_ERROR", "m" },
+    { 1008,   0, T(FLOAT) | T(SHORT2), "ACTIVE_NAV_SYSTEM_TRACK_ERROR_ANGLE", "deg" },
+    { 1009,   0, T(SHORT), "ACTIVE_NAV_SYSTEM_TIME_TO_GO", "min" },
+    { 1010,   0, T(SHORT), "ACTIVE_NAV_SYSTEM_ESTIMATED_TIME_OF_ARRIVAL", "min" },
+    { 1011,   0, T(SHORT), "ACTIVE_NAV_SYSTEM_ESTIMATED_ENROUTE_TIME", "min" },
+    { 1012,   0, T(ACHAR4), "NAV_WAYPOINT_IDENTIFIER_0_3", "" },
+    { 1013,   0, T(ACHAR4), "NAV_WAYPOINT_IDENTIFIER_4_7", "" },
+    { 1014,   0, T(ACHAR4), "NAV_WAYPOINT_IDENTIFIER_8_11", "" },
+    { 1015,   0, T(ACHAR4), "NAV_WAYPOINT_IDENTIFIER_12_15", "" },
+    { 1016,   0, T(LONG) | T(SHORT), "NAV_WAYPOINT_TYPE_IDENTIFIER", "" },
+    { 1017,   0, T(FLOAT) | T(SHORT2), "NAV_WAYPOINT_LATITUDE", "deg" },
+    { 1018,   0, T(FLOAT) | T(SHORT2), "NAV_WAYPOINT_LONGITUDE", "deg" },
+    { 1019,   0, T(FLOAT) | T(SHORT2), "NAV_WAYPOINT_MINIMUM_ALTITUDE", "m" },
+    { 1020,   0, T(FLOAT) | T(SHORT2), "NAV_WAYPOINT_MINIMUM_FLIGHT_LEVEL", "m" },
+    { 1021,   0, T(FLOAT) | T(SHORT2), "NAV_WAYPOINT_MINIMUM_RADAR_HEIGHT", "m" },
+    { 1022,   0, T(FLOAT) | T(SHORT2), "NAV_WAYPOINT_MINIMUM_HEIGHT_ABOVE_ELLIPSOID", "m" },
+    { 1023,   0, T(FLOAT) | T(SHORT2), "NAV_WAYPOINT_MAXIMUM_ALTITUDE", "m" },
+    { 1024,   0, T(FLOAT) | T(SHORT2), "NAV_WAYPOINT_MAXIMUM_FLIGHT_LEVEL", "m" },
+    { 1025,   0, T(FLOAT) | T(SHORT2), "NAV_WAYPOINT_MAXIMUM_RADAR_HEIGHT", "m" },
+    { 1026,   0, T(FLOAT) | T(SHORT2), "NAV_WAYPOINT_MAXIMUM_HEIGHT_ABOVE_ELLIPSOID", "m" },
+    { 1027,   0, T(FLOAT) | T(SHORT2), "NAV_WAYPOINT_PLANNED_ALTITUDE", "m" },
+    { 1028,   0, T(FLOAT) | T(SHORT2), "NAV_WAYPOINT_PLANNED_FLIGHT_LEVEL", "m" },
+    { 1029,   0, T(FLOAT) | T(SHORT2), "NAV_WAYPOINT_PLANNED_RADAR_HEIGHT", "m" },
+    { 1030,   0, T(FLOAT) | T(SHORT2), "NAV_WAYPOINT_PLANNED_HEIGHT_ABOVE_ELLIPSOID", "m" },
+    { 1031,   0, T(FLOAT) | T(SHORT2), "DISTANCE_TO_NAV_WAYPOINT", "m" },
+    { 1032,   0, T(SHORT), "TIME_TO_GO_TO_NAV_WAYPOINT", "min" },
+    { 1033,   0, T(SHORT), "NAV_WAYPOINT_ESTIMATED_TIME_OF_ARRIVAL", "min" },
+    { 1034,   0, T(SHORT), "NAV_WAYPOINT_ESTIMATED_ENROUTE_TIME", "min" },
+    { 1035,   0, T(BLONG) | T(BSHORT), "NAV_WAYPOINT_STATUS_INFORMATION", "" },
+    { 1036,   0, T(DOUBLEL) | T(DOUBLEH) | T(FLOAT) | T(SHORT2), "GPS_AIRCRAFT_LATITUDE", "deg" },
+    { 1037,   0, T(DOUBLEL) | T(DOUBLEH) | T(FLOAT) | T(SHORT), "GPS_AIRCRAFT_LONGITUDE", "deg" },
+    { 1038,   0, T(FLOAT) | T(SHORT2), "GPS_AIRCRAFT_HEIGHT_ABOVE_ELLIPSOID", "m" },
+    { 1039,   0, T(FLOAT) | T(SHORT2), "GPS_GROUND_SPEED", "m/s" },
+    { 1040,   0, T(FLOAT) | T(SHORT2), "GPS_TRUE_TRACK", "deg" },
+    { 1041,   0, T(FLOAT) | T(SHORT2), "GPS_MAGNETIC_TRACK", "deg" },
+    { 1042,   0, T(FLOAT) | T(SHORT2), "GPS_CROSS_TRACK_ERROR", "m" },
+    { 1043,   0, T(FLOAT) | T(SHORT2), "GPS_TRACK_ERROR_ANGLE", "deg" },
+    { 1044,   0, T(FLOAT) | T(SHORT2), "GPS_GLIDESLOPE_DEVIATION", "m" },
+    { 1045,   0, T(ULONG) | T(USHORT), "GPS_PREDICTED_RAIM", "" },
+    { 1046,   0, T(FLOAT) | T(SHORT2), "GPS_VERTICAL_FIGURE_OF_MERIT", "m" },
+    { 1047,   0, T(FLOAT) | T(SHORT2), "GPS_HORIZONTAL_FIGURE_OF_MERIT", "m" },
+    { 1048,   0, T(SHORT), "GPS_MODE_OF_OPERATION", "" },
+    { 1049,   0, T(FLOAT) | T(SHORT2), "INS_AIRCRAFT_LATITUDE", "deg" },
+    { 1050,   0, T(FLOAT) | T(SHORT), "INS_AIRCRAFT_LONGITUDE", "deg" },
+    { 1051,   0, T(FLOAT) | T(SHORT2), "INS_AIRCRAFT_HEIGHT_ABOVE_ELLIPSOID", "m" },
+    { 1052,   0, T(FLOAT) | T(SHORT2), "INS_AIRCRAFT_GROUND_SPEED", "m/s" },
+    { 1053,   0, T(FLOAT) | T(SHORT2), "INS_AIRCRAFT_TRUE_TRACK", "deg" },
+    { 1054,   0, T(FLOAT) | T(SHORT2), "INS_AIRCRAFT_MAGNETIC_TRACK", "deg" },
+    { 1055,   0, T(FLOAT) | T(SHORT2), "INS_AIRCRAFT_CROSS_TRACK_ERROR", "m" },
+    { 1056,   0, T(FLOAT) | T(SHORT2), "INS_AIRCRAFT_TRACK_ERROR_ANGLE", "deg" },
+    { 1057,   0, T(FLOAT) | T(SHORT2), "INS_VERTICAL_FIGURE_OF_MERIT", "m" },
+    { 1058,   0, T(FLOAT) | T(SHORT2), "INS_HORIZONTAL_FIGURE_OF_MERIT", "m" },
+    { 1059,   0, T(FLOAT) | T(SHORT2), "AUXILIARY_NAV_SYSTEM_AIRCRAFT_LATITUDE", "deg" },
+    { 1060,   0, T(FLOAT) | T(SHORT), "AUXILIARY_NAV_SYSTEM_AIRCRAFT_LONGITUDE", "deg" },
+    { 1061,   0, T(FLOAT) | T(SHORT2), "AUXILIARY_NAV_SYSTEM_AIRCRAFT_HEIGHT_ABOVE_ELLIPSOID", "m" },
+    { 1062,   0, T(FLOAT) | T(SHORT2), "AUXILIARY_NAV_SYSTEM_AIRCRAFT_GROUND_SPEED", "m/s" },
+    { 1063,   0, T(FLOAT) | T(SHORT2), "AUXILIARY_NAV_SYSTEM_AIRCRAFT_TRUE_TRACK", "deg" },
+    { 1064,   0, T(FLOAT) | T(SHORT2), "AUXILIARY_NAV_SYSTEM_AIRCRAFT_MAGNETIC_TRACK", "deg" },
+    { 1065,   0, T(FLOAT) | T(SHORT2), "AUXILIARY_NAV_SYSTEM_AIRCRAFT_CROSS_TRACK_ERROR", "m" },
+    { 1066,   0, T(FLOAT) | T(SHORT2), "AUXILIARY_NAV_SYSTEM_AIRCRAFT_TRACK_ERROR_ANGLE", "deg" },
+    { 1067,   0, T(FLOAT) | T(SHORT2), "AUXILIARY_NAV_SYSTEM_VERTICAL_FIGURE_OF_MERIT", "m" },
+    { 1068,   0, T(FLOAT) | T(SHORT2), "AUXILIARY_NAV_SYSTEM_HORIZONTAL_FIGURE_OF_MERIT", "m" },
+    { 1069,   0, T(FLOAT) | T(SHORT2), "MAGNETIC_HEADING", "deg" },
+    { 1070,   0, T(FLOAT) | T(SHORT2), "RADIO_HEIGHT", "m" },
+    { 1071,   0, T(FLOAT) | T(SHORT2), "DME_1_DISTANCE", "m" },
+    { 1072,   0, T(FLOAT) | T(SHORT2), "DME_2_DISTANCE", "m" },
+    { 1073,   0, T(FLOAT) | T(SHORT2), "DME_3_DISTANCE", "m" },
+    { 1074,   0, T(FLOAT) | T(SHORT2), "DME_4_DISTANCE", "m" },
+    { 1075,   0, T(SHORT), "DME_1_TIME_TO_GO", "min" },
+    { 1076,   0, T(SHORT), "DME_2_TIME_TO_GO", "min" },
+    { 1077,   0, T(SHORT), "DME_3_TIME_TO_GO", "min" },
+    { 1078,   0, T(SHORT), "DME_4_TIME_TO_GO", "min" },
+    { 1079,   0, T(FLOAT) | T(SHORT2), "DME_1_GROUND_SPEED", "m/s" },
+    { 1080,   0, T(FLOAT) | T(SHORT2), "DME_2_GROUND_SPEED", "m/s" },
+    { 1081,   0, T(FLOAT) | T(SHORT2), "DME_3_GROUND_SPEED", "m/s" },
+    { 1082,   0, T(FLOAT) | T(SHORT2), "DME_4_GROUND_SPEED", "m/s" },
+    { 1083,   0, T(FLOAT) | T(SHORT2), "ADF_1_BEARING", "deg" },
+    { 1084,   0, T(FLOAT) | T(SHORT2), "ADF_2_BEARING", "deg" },
+    { 1085,   0, T(FLOAT) | T(SHORT2), "ADF_3_BEARING", "deg" },
+    { 1086,   0, T(FLOAT) | T(SHORT2), "ADF_4_BEARING", "deg" },
+    { 1087,   0, T(FLOAT) | T(SHORT2), "ILS_1_LOCALIZE_DEVIATION", "deg" },
+    { 1088,   0, T(FLOAT) | T(SHORT2), "ILS_2_LOCALIZE_DEVIATION", "deg" },
+    { 1089,   0, T(FLOAT) | T(SHORT2), "ILS_3_LOCALIZE_DEVIATION", "deg" },
+    { 1090,   0, T(FLOAT) | T(SHORT2), "ILS_4_LOCALIZE_DEVIATION", "deg" },
+    { 1091,   0, T(FLOAT) | T(SHORT2), "ILS_1_GLIDESLOPE_DEVIATION", "deg" },
+    { 1092,   0, T(FLOAT) | T(SHORT2), "ILS_2_GLIDESLOPE_DEVIATION", "deg" },
+    { 1093,   0, T(FLOAT) | T(SHORT2), "ILS_3_GLIDESLOPE_DEVIATION", "deg" },
+    { 1094,   0, T(FLOAT) | T(SHORT2), "ILS_4_GLIDESLOPE_DEVIATION", "deg" },
+    { 1095,   0, T(FLOAT) | T(SHORT2), "FLIGHT_DIRECTOR_1_PITCH_DEVIATION", "deg" },
+    { 1096,   0, T(FLOAT) | T(SHORT2), "FLIGHT_DIRECTOR_2_PITCH_DEVIATION", "deg" },
+    { 1097,   0, T(FLOAT) | T(SHORT2), "FLIGHT_DIRECTOR_1_ROLL_DEVIATION", "deg" },
+    { 1098,   0, T(FLOAT) | T(SHORT2), "FLIGHT_DIRECTOR_2_ROLL_DEVIATION", "deg" },
+    { 1099,   0, T(FLOAT) | T(SHORT2), "DECISION_HEIGHT", "m" },
+    { 1100,   0, T(FLOAT) | T(ACHAR4), "VHF_1_COM_FREQUENCY", "MHz" },
+    { 1101,   0, T(FLOAT) | T(ACHAR4), "VHF_2_COM_FREQUENCY", "MHz" },
+    { 1102,   0, T(FLOAT) | T(ACHAR4), "VHF_3_COM_FREQUENCY", "MHz" },
+    { 1103,   0, T(FLOAT) | T(ACHAR4), "VHF_4_COM_FREQUENCY", "MHz" },
+    { 1104,   0, T(FLOAT) | T(ACHAR4), "VOR_ILS_1_FREQUENCY", "MHz" },
+    { 1105,   0, T(FLOAT) | T(ACHAR4), "VOR_ILS_2_FREQUENCY", "MHz" },
+    { 1106,   0, T(FLOAT) | T(ACHAR4), "VOR_ILS_3_FREQUENCY", "MHz" },
+    { 1107,   0, T(FLOAT) | T(ACHAR4), "VOR_ILS_4_FREQUENCY", "MHz" },
+    { 1108,   0, T(FLOAT) | T(ACHAR4), "ADF_1_FREQUENCY", "KHz" },
+    { 1109,   0, T(FLOAT) | T(ACHAR4), "ADF_2_FREQUENCY", "KHz" },
+    { 1110,   0, T(FLOAT) | T(ACHAR4), "ADF_3_FREQUENCY", "KHz" },
+    { 1111,   0, T(FLOAT) | T(ACHAR4), "ADF_4_FREQUENCY", "KHz" },
+    { 1112,   0, T(FLOAT) | T(ACHAR4), "DME_1_CHANNEL", "" },
+    { 1113,   0, T(FLOAT) | T(ACHAR4), "DME_2_CHANNEL", "" },
+    { 1114,   0, T(FLOAT) | T(ACHAR4), "DME_3_CHANNEL", "" },
+    { 1115,   0, T(FLOAT) | T(ACHAR4), "DME_4_CHANNEL", "" },
+    { 1116,   0, T(FLOAT) | T(ACHAR4), "TRANSPONDER_1_CODE", "" },
+    { 1117,   0, T(FLOAT) | T(ACHAR4), "TRANSPONDER_2_CODE", "" },
+    { 1118,   0, T(FLOAT) | T(ACHAR4), "TRANSPONDER_3_CODE", "" },
+    { 1119,   0, T(FLOAT) | T(ACHAR4), "TRANSPONDER_4_CODE", "" },
+    { 1120,   0, T(FLOAT) | T(SHORT2), "DESIRED_TRACK_ANGLE", "deg" },
+    { 1121,   0, T(FLOAT) | T(SHORT2), "MAGNETIC_VARIATION", "deg" },
+    { 1122,   0, T(FLOAT) | T(SHORT2), "SELECTED_GLIDEPATH_ANGLE", "deg" },
+    { 1123,   0, T(FLOAT) | T(SHORT2), "SELECTED_RUNWAY_HEADING", "deg" },
+    { 1124,   0, T(FLOAT) | T(SHORT2), "COMPUTED_VERTICAL_VELOCITY", "m/s" },
+    { 1125,   0, T(FLOAT) | T(SHORT2), "SELECTED_COURSE", "deg" },
+    { 1126,   0, T(FLOAT) | T(SHORT2), "VOR_1_RADIAL", "deg" },
+    { 1127,   0, T(FLOAT) | T(SHORT2), "VOR_2_RADIAL", "deg" },
+    { 1128,   0, T(FLOAT) | T(SHORT2), "VOR_3_RADIAL", "deg" },
+    { 1129,   0, T(FLOAT) | T(SHORT2), "VOR_4_RADIAL", "deg" },
+    { 1130,   0, T(FLOAT) | T(SHORT2), "TRUE_EAST_VELOCITY", "m/s" },
+    { 1131,   0, T(FLOAT) | T(SHORT2), "TRUE_NORTH_VELOCITY", "m/s" },
+    { 1132,   0, T(FLOAT) | T(SHORT2), "TRUE_UP_VELOCITY", "m/s" },
+    { 1133,   0, T(FLOAT) | T(SHORT2), "TRUE_HEADING", "deg" },
+    { 1175,   0, T(BLONG) | T(BSHORT), "GEAR_LEVER_SWITCHES", "" },
+    { 1176,   0, T(BLONG) | T(BSHORT), "GEAR_LEVER_LIGHTS_WOW_SOLENOID", "" },
+    { 1177,   0, T(FLOAT) | T(SHORT2), "LANDING_GEAR_1_TIRE_PRESSURE", "hPa" },
+    { 1178,   0, T(FLOAT) | T(SHORT2), "LANDING_GEAR_2_TIRE_PRESSURE", "hPa" },
+    { 1179,   0, T(FLOAT) | T(SHORT2), "LANDING_GEAR_3_TIRE_PRESSURE", "hPa" },
+    { 1180,   0, T(FLOAT) | T(SHORT2), "LANDING_GEAR_4_TIRE_PRESSURE", "hPa" },
+    { 1181,   0, T(FLOAT) | T(SHORT2), "LANDING_GEAR_1_BRAKE_PAD_THICKNESS", "mm" },
+    { 1182,   0, T(FLOAT) | T(SHORT2), "LANDING_GEAR_2_BRAKE_PAD_THICKNESS", "mm" },
+    { 1183,   0, T(FLOAT) | T(SHORT2), "LANDING_GEAR_3_BRAKE_PAD_THICKNESS", "mm" },
+    { 1184,   0, T(FLOAT) | T(SHORT2), "LANDING_GEAR_4_BRAKE_PAD_THICKNESS", "mm" },
+    { 1200,   0, T(CHAR4), "UTC", "" },
+    { 1201,   0, T(FLOAT) | T(SHORT2), "CABIN_PRESSURE", "hPa" },
+    { 1202,   0, T(FLOAT) | T(SHORT2), "CABIN_ALTITUDE", "m" },
+    { 1203,   0, T(FLOAT) | T(SHORT2), "CABIN_TEMPERATURE", "K" },
+    { 1204,   0, T(FLOAT) | T(SHORT2), "LONGITUDINAL_CENTER_OF_GRAVITY", "% MAC" },
+    { 1205,   0, T(FLOAT) | T(SHORT2), "LATERAL_CENTER_OF_GRAVITY", "% MAC" },
+    { 1206,   0, T(CHAR4), "DATE", "" },
+    { 1800,   0, T(USHORT), "UAV_ROTOR_RPM_1", "RPM" },
+    { 1801,   0, T(USHORT), "UAV_ROTOR_RPM_2", "RPM" },
+    { 1802,   0, T(USHORT), "UAV_ROTOR_RPM_3", "RPM" },
+    { 1803,   0, T(USHORT), "UAV_ROTOR_RPM_4", "RPM" },
+    { 1804,   0, T(USHORT), "UAV_ROTOR_RPM_5", "RPM" },
+    { 1805,   0, T(USHORT), "UAV_ROTOR_RPM_6", "RPM" },
+    { 1806,   0, T(USHORT), "UAV_ROTOR_RPM_7", "RPM" },
+    { 1807,   0, T(USHORT), "UAV_ROTOR_RPM_8", "RPM" },
+    { 1810,   0, T(FLOAT), "UAV_GIMBAL_ROLL", "deg" },
+    { 1811,   0, T(FLOAT), "UAV_GIMBAL_ROLL_RATE", "deg/s" },
+    { 1812,   0, T(FLOAT), "UAV_GIMBAL_PITCH", "deg" },
+    { 1813,   0, T(FLOAT), "UAV_GIMBAL_PITCH_RATE", "deg/s" },
+    { 1814,   0, T(FLOAT), "UAV_GIMBAL_YAW", "deg" },
+    { 1815,   0, T(FLOAT), "UAV_GIMBAL_YAW_RATE", "deg/s" },
+    { 1820,   0, T(CHAR), "UAV_GRIPPER_GRIP_COMMAND", "" },
+    { 1821,   0, T(CHAR), "UAV_GRIPPER_GRIP_STATE", "" },
+};
+
+#undef T
+
+const CanasParamRegistry canas_param_registry_default =
+{
+    _entries,
+    sizeof(_entries) / sizeof(_entries[0])
+};
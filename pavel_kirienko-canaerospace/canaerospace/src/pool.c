@@ -0,0 +1,132 @@
+/*
+ * Size-class pool allocator
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include <string.h>
+#include <canaerospace/pool.h>
+#include "debug.h"
+
+typedef union
+{
+    struct
+    {
+        uint8_t size_class;
+        uint8_t allocated;          ///< Catches double free
+    } info;
+    uint64_t align_;
+    void* align_ptr_;
+} BlockHeader;
+
+typedef char _block_header_size_check[(sizeof(BlockHeader) == CANAS_POOL_ALIGNMENT) ? 1 : -1];
+
+static inline uint32_t _classBlockSize(int size_class)
+{
+    return ((size_class & 1) ? 24u : 16u) << (size_class / 2);
+}
+
+/**
+ * Smallest class that fits the block, or CANAS_POOL_CLASS_COUNT if there is none.
+ */
+static int _classOf(uint32_t block_size)
+{
+    if (block_size <= 16)
+        return 0;
+    const uint32_t m = block_size - 1;
+    int msb = 4;
+    while ((m >> (msb + 1)) != 0)
+        msb++;
+    const int size_class = ((m >> (msb - 1)) & 1) ? (2 * (msb - 3)) : (2 * (msb - 4) + 1);
+    return (size_class < CANAS_POOL_CLASS_COUNT) ? size_class : CANAS_POOL_CLASS_COUNT;
+}
+
+int canasPoolInit(CanasPool* ppool, void* pbuf, uint32_t size)
+{
+    if (ppool == NULL || pbuf == NULL)
+        return -CANAS_ERR_ARGUMENT;
+    memset(ppool, 0, sizeof(*ppool));
+
+    const uintptr_t misalignment = (uintptr_t)pbuf % CANAS_POOL_ALIGNMENT;
+    const uint32_t padding = misalignment ? (CANAS_POOL_ALIGNMENT - misalignment) : 0;
+    if (size < padding)
+        return -CANAS_ERR_ARGUMENT;
+    ppool->pbuf_next = (uint8_t*)pbuf + padding;
+    ppool->pbuf_end = ppool->pbuf_next + (size - padding);
+    ppool->buf_size = size - padding;
+    return 0;
+}
+
+void* canasPoolAlloc(CanasPool* ppool, int size)
+{
+    if (ppool == NULL || size <= 0)
+        return NULL;
+
+    const int size_class = _classOf((uint32_t)size + sizeof(BlockHeader));
+    if (size_class >= CANAS_POOL_CLASS_COUNT)
+    {
+        ppool->failures++;
+        return NULL;
+    }
+    const uint32_t block_size = _classBlockSize(size_class);
+    CanasPoolClassStats* pstats = ppool->classes + size_class;
+
+    BlockHeader* phdr = NULL;
+    if (ppool->free_lists[size_class] != NULL)
+    {
+        phdr = (BlockHeader*)ppool->free_lists[size_class] - 1;
+        memcpy(&ppool->free_lists[size_class], phdr + 1, sizeof(void*));   // Next free block
+    }
+    else if ((uint32_t)(ppool->pbuf_end - ppool->pbuf_next) >= block_size)
+    {
+        phdr = (BlockHeader*)ppool->pbuf_next;
+        ppool->pbuf_next += block_size;
+        ppool->buf_used += block_size;
+        phdr->info.size_class = (uint8_t)size_class;
+        pstats->blocks_total++;
+    }
+    else
+    {
+        ppool->failures++;
+        return NULL;
+    }
+    phdr->info.allocated = 1;
+
+    pstats->blocks_in_use++;
+    if (pstats->blocks_in_use > pstats->blocks_peak)
+        pstats->blocks_peak = pstats->blocks_in_use;
+    ppool->bytes_in_use += block_size;
+    if (ppool->bytes_in_use > ppool->bytes_peak)
+        ppool->bytes_peak = ppool->bytes_in_use;
+    return phdr + 1;
+}
+
+void canasPoolFree(CanasPool* ppool, void* ptr)
+{
+    if (ppool == NULL || ptr == NULL)
+        return;
+
+    BlockHeader* phdr = (BlockHeader*)ptr - 1;
+    if (!phdr->info.allocated || phdr->info.size_class >= CANAS_POOL_CLASS_COUNT)
+    {
+        CANAS_TRACE("pool: bad free %p\n", ptr);
+        return;
+    }
+    const int size_class = phdr->info.size_class;
+    phdr->info.allocated = 0;
+
+    memcpy(ptr, &ppool->free_lists[size_class], sizeof(void*));
+    ppool->free_lists[size_class] = ptr;
+
+    ppool->classes[size_class].blocks_in_use--;
+    ppool->bytes_in_use -= _classBlockSize(size_class);
+}
+
+void* canasPoolMallocFn(CanasInstance* pi, int size)
+{
+    return canasPoolAlloc((CanasPool*)pi->config.pmem_state, size);
+}
+
+void canasPoolFreeFn(CanasInstance* pi, void* ptr)
+{
+    canasPoolFree((CanasPool*)pi->config.pmem_state, ptr);
+}
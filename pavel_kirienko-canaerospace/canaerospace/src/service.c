@@ -7,6 +7,8 @@
 #include <string.h>
 #include "debug.h"
 #include "service.h"
+#include "msgclass.h"
+#include "history.h"
 
 #ifdef __GNUC__
 // RANGEINCLUSIVE() may produce a lot of these warnings
@@ -17,20 +19,11 @@
 
 static int _serviceChannelFromMessageID(uint16_t msg_id, bool* pisrequest)
 {
-    static const uint16_t REQ_MASK = ~(uint16_t)1;
-    if (RANGEINCLUSIVE(msg_id, CANAS_MSGTYPE_NODE_SERVICE_HIGH_MIN, CANAS_MSGTYPE_NODE_SERVICE_HIGH_MAX))
-    {
-        int srvchan = ((msg_id & REQ_MASK) - 128) / 2;
-        *pisrequest = !(msg_id & 1);
-        return srvchan + CANAS_SERVICE_CHANNEL_HIGH_MIN;
-    }
-    if (RANGEINCLUSIVE(msg_id, CANAS_MSGTYPE_NODE_SERVICE_LOW_MIN, CANAS_MSGTYPE_NODE_SERVICE_LOW_MAX))
-    {
-        int srvchan = ((msg_id & REQ_MASK) - 2000) / 2;
-        *pisrequest = !(msg_id & 1);
-        return srvchan + CANAS_SERVICE_CHANNEL_LOW_MIN;
-    }
-    return -CANAS_ERR_BAD_MESSAGE_ID;
+    const uint8_t cls = canasMessageClass(msg_id);
+    if (cls == CANAS_MSGCLASS_PARAM || cls == CANAS_MSGCLASS_WTF)
+        return -CANAS_ERR_BAD_MESSAGE_ID;
+    *pisrequest = !(cls & 1);
+    return cls >> 1;
 }
 
 int canasServiceChannelToMessageID(uint8_t service_channel, bool isrequest)
@@ -53,35 +46,54 @@ int canasServiceChannelToMessageID(uint8_t service_channel, bool isrequest)
     return -CANAS_ERR_BAD_SERVICE_CHAN;
 }
 
-static void _issueRequestCallback(CanasInstance* pi, CanasServiceSubscription* psrv, CanasMessage* pmsg,
+static void _issueRequestCallback(CanasInstance* pi, CanasServiceSubscription* psrv, const CanasMessage* pmsg,
                                   uint8_t service_channel, uint64_t timestamp_usec)
 {
-    if (psrv->callback_request == NULL)
-        return;
-
-    CanasServiceRequestCallbackArgs args;
-    memset(&args, 0, sizeof(args));
-    args.message = *pmsg;
-    args.pstate = psrv->pstate;
-    args.service_channel = (uint8_t)service_channel;
-    args.timestamp_usec = timestamp_usec;
+    if (psrv->callback_request_ref != NULL)
+    {
+        CanasServiceRequestCallbackRefArgs args;
+        args.pmessage = pmsg;
+        args.pstate = psrv->pstate;
+        args.service_channel = service_channel;
+        args.timestamp_usec = timestamp_usec;
 
-    psrv->callback_request(pi, &args);
+        psrv->callback_request_ref(pi, &args);
+    }
+    else if (psrv->callback_request != NULL)
+    {
+        CanasServiceRequestCallbackArgs args;
+        memset(&args, 0, sizeof(args));
+        args.message = *pmsg;
+        args.pstate = psrv->pstate;
+        args.service_channel = service_channel;
+        args.timestamp_usec = timestamp_usec;
+
+        psrv->callback_request(pi, &args);
+    }
 }
 
-static void _issueResponseCallback(CanasInstance* pi, CanasServiceSubscription* psrv, CanasMessage* pmsg,
+static void _issueResponseCallback(CanasInstance* pi, CanasServiceSubscription* psrv, const CanasMessage* pmsg,
                                    uint64_t timestamp_usec)
 {
-    if (psrv->callback_response == NULL)
-        return;
+    if (psrv->callback_response_ref != NULL)
+    {
+        CanasServiceResponseCallbackRefArgs args;
+        args.pmessage = pmsg;
+        args.pstate = psrv->pstate;
+        args.timestamp_usec = timestamp_usec;
 
-    CanasServiceResponseCallbackArgs args;
-    memset(&args, 0, sizeof(args));
-    args.message = *pmsg;
-    args.pstate = psrv->pstate;
-    args.timestamp_usec = timestamp_usec;
+        psrv->callback_response_ref(pi, &args);
+    }
+    else if (psrv->callback_response != NULL)
+    {
+        CanasServiceResponseCallbackArgs args;
+        memset(&args, 0, sizeof(args));
+        args.message = *pmsg;
+        args.pstate = psrv->pstate;
+        args.timestamp_usec = timestamp_usec;
 
-    psrv->callback_response(pi, &args);
+        psrv->callback_response(pi, &args);
+    }
 }
 
 static bool _applyFilters(CanasInstance* pi, uint8_t service_channel, bool is_service_request, CanasMessage* pmsg)
@@ -130,7 +142,7 @@ bool canasIsInterestingServiceMessage(CanasInstance* pi, uint16_t msg_id, CanasM
 }
 
 void canasHandleReceivedService(CanasInstance* pi, CanasServiceSubscription* psrv, uint8_t iface, uint16_t msg_id,
-                                CanasMessage* pmsg, const CanasCanFrame* pframe, uint64_t timestamp_usec)
+                                const CanasMessage* pmsg, const CanasCanFrame* pframe, uint64_t timestamp_usec)
 {
     bool is_service_request = false;
     int service_channel = _serviceChannelFromMessageID(msg_id, &is_service_request);
@@ -138,34 +150,12 @@ void canasHandleReceivedService(CanasInstance* pi, CanasServiceSubscription* psr
     uint32_t header = 0;
     memcpy(&header, pframe->data, 4);  // Byte order doesn't matter.
 
-    int oldest = 0;
-    // Ugly but works.
-    for (int i = 0; i < psrv->history_len; i++)
+    if (canasHistoryCheckRepetition(&pi->service_history, header, iface, timestamp_usec,
+                                    pi->config.repeat_timeout_usec))
     {
-        CanasServiceFrameHistoryEntry* ph = psrv->history + i;
-        if (ph->timestamp_usec < psrv->history[oldest].timestamp_usec)
-            oldest = i;
-        if (ph->timestamp_usec == 0)                                          // Empty entry, no match
-            continue;
-        if (ph->header != header)
-            continue;
-        if ((timestamp_usec - ph->timestamp_usec) > pi->config.repeat_timeout_usec)
-            continue;
-        if (ph->ifaces_mask & (1 << iface))                                   // Interface matched - no repetition
-            continue;
-        // well, it is repetition
-        ph->ifaces_mask |= 1 << iface;                                        // Mark bit of this iface and that's it.
-        CANAS_TRACE("serv rep msgid=%03x ifmask=%02x srvcode=%i\n", (unsigned int)msg_id,
-                    (unsigned int)ph->ifaces_mask, (int)psrv->service_code);
+        CANAS_TRACE("serv rep msgid=%03x srvcode=%i\n", (unsigned int)msg_id, (int)psrv->service_code);
         return;
     }
-    if (psrv->history_len > 0)
-    {
-        CanasServiceFrameHistoryEntry* ph = psrv->history + oldest;
-        ph->header = header;
-        ph->ifaces_mask = 1 << iface;
-        ph->timestamp_usec = timestamp_usec;
-    }
 
     if (is_service_request)
         _issueRequestCallback(pi, psrv, pmsg, (uint8_t)service_channel, timestamp_usec);
@@ -193,6 +183,30 @@ void canasPollServices(CanasInstance* pi, uint64_t timestamp_usec)
     }
 }
 
+uint64_t canasServicesNextDeadline(CanasInstance* pi)
+{
+    // Services are never polled more often than this, whatever they report
+    const uint64_t next_poll = pi->last_service_ts + pi->config.service_poll_interval_usec;
+    uint64_t deadline = CANAS_DEADLINE_NONE;
+    for (CanasServiceSubscription* psrv = pi->pservice_subs; psrv != NULL; psrv = psrv->pnext)
+    {
+        if (psrv->callback_poll == NULL)
+            continue;
+        uint64_t srv_deadline = next_poll;         // Services that can't tell must be polled periodically
+        if (psrv->callback_deadline != NULL)
+        {
+            srv_deadline = psrv->callback_deadline(pi, psrv->pstate);
+            if (srv_deadline == CANAS_DEADLINE_NONE)
+                continue;
+            if (srv_deadline < next_poll)
+                srv_deadline = next_poll;
+        }
+        if (srv_deadline < deadline)
+            deadline = srv_deadline;
+    }
+    return deadline;
+}
+
 bool canasIsValidServiceChannel(uint8_t service_channel)
 {
     return
@@ -21,7 +21,7 @@ static const int CANAS_DEFAULT_SERVICE_POLL_INTERVAL_USEC = 10 * 1000;
 
 /**
  * History length for repetition detection.
- * Expressed in number of frames to track.
+ * Expressed in number of frames to track, for all services together.
  */
 static const int CANAS_DEFAULT_SERVICE_HIST_LEN = 32;
 
@@ -33,10 +33,12 @@ static const int CANAS_DEFAULT_SERVICE_REQUEST_TIMEOUT_USEC = 100 * 1000;
 bool canasIsInterestingServiceMessage(CanasInstance* pi, uint16_t msg_id, CanasMessage *pmsg);
 
 void canasHandleReceivedService(CanasInstance* pi, CanasServiceSubscription* psrv, uint8_t iface, uint16_t msg_id,
-                                CanasMessage *pmsg, const CanasCanFrame* pframe, uint64_t timestamp_usec);
+                                const CanasMessage* pmsg, const CanasCanFrame* pframe, uint64_t timestamp_usec);
 
 void canasPollServices(CanasInstance* pi, uint64_t timestamp_usec);
 
+uint64_t canasServicesNextDeadline(CanasInstance* pi);
+
 int canasServiceChannelToMessageID(uint8_t service_channel, bool isrequest);
 
 bool canasIsValidServiceChannel(uint8_t service_channel);
@@ -32,6 +32,7 @@ enum
 
 typedef struct
 {
+    CanasTimer timer;             // Must be the first field; fires when the session needs to be polled
     union
     {
         CanasSrvDdsMasterDoneCallback dds_master_done;
@@ -64,6 +65,12 @@ typedef struct
     SessionEntry entries[];
 } ServiceState;
 
+static void _eraseSession(CanasInstance* pi, SessionEntry* pses)
+{
+    canasTimerStop(pi, &pses->timer);
+    memset(pses, 0, sizeof(*pses));
+}
+
 static uint8_t _msgcountByDatalen(uint16_t datalen)
 {
     return ((datalen - 1) / PAYLOAD_BYTES_PER_MESSAGE) + 1;
@@ -141,7 +148,7 @@ static void _ddsMasterDone(CanasInstance* pi, SessionEntry* pses, CanasSrvDataSe
         cbargs.remote_error_code = *premoteerr;
     if (pses->callback.dds_master_done != NULL)           // Callback is required
         pses->callback.dds_master_done(pi, &cbargs);
-    memset(pses, 0, sizeof(*pses));                       // Erase this entry
+    _eraseSession(pi, pses);
 }
 
 static int _ddsMasterTransmitNextChunk(CanasInstance* pi, SessionEntry* pses, bool* plast_chunk)
@@ -202,6 +209,22 @@ static void _ddsMasterPoll(CanasInstance* pi, CanasServicePollCallbackArgs* parg
     }
 }
 
+static uint64_t _ddsMasterDeadline(const ServiceState* pstate, const SessionEntry* pses)
+{
+    switch (pses->state)
+    {
+    case DDS_MASTER_STATE_SDRM_PENDING:
+        return pses->update_timestamp + SDRM_SURM_TIMEOUT_USEC + 1;
+    case DDS_MASTER_STATE_TRANSMISSION:
+        return pses->update_timestamp + pstate->tx_interval_usec;
+    case DDS_MASTER_STATE_CHECKSUM:
+    case DDS_MASTER_STATE_XOFF:
+        return pses->update_timestamp + pstate->session_timeout_usec + 1;
+    default:
+        return 0;                         // Invalid state will be handled by the next poll
+    }
+}
+
 static void _ddsMasterResponse(CanasInstance* pi, CanasServiceResponseCallbackArgs* pargs, SessionEntry* pses)
 {
     pses->update_timestamp = pargs->timestamp_usec;
@@ -263,8 +286,7 @@ static void _ddsMasterResponse(CanasInstance* pi, CanasServiceResponseCallbackAr
 
 static void _ddsSlaveDone(CanasInstance* pi, SessionEntry* pses)
 {
-    (void)pi;
-    memset(pses, 0, sizeof(*pses));                       // Erase this entry
+    _eraseSession(pi, pses);
 }
 
 static int _ddsSlaveInit(CanasInstance* pi, CanasServiceRequestCallbackArgs* pargs, SessionEntry* pses)
@@ -316,6 +338,13 @@ static void _ddsSlavePoll(CanasInstance* pi, CanasServicePollCallbackArgs* pargs
     }
 }
 
+static uint64_t _ddsSlaveDeadline(const ServiceState* pstate, const SessionEntry* pses)
+{
+    if (pses->state != 0)
+        return 0;
+    return pses->update_timestamp + pstate->session_timeout_usec + 1;
+}
+
 static void _ddsSlaveRequest(CanasInstance* pi, CanasServiceRequestCallbackArgs* pargs, SessionEntry* pses)
 {
     ServiceState* pstate = (ServiceState*)pargs->pstate;
@@ -395,7 +424,7 @@ static void _dusMasterDone(CanasInstance* pi, SessionEntry* pses, CanasSrvDataSe
         cbargs.remote_error_code = *premoteerr;
     if (pses->callback.dus_master_done != NULL)           // This callback must never be NULL, anyway
         pses->callback.dus_master_done(pi, &cbargs);
-    memset(pses, 0, sizeof(*pses));                       // Erase this entry
+    _eraseSession(pi, pses);
 }
 
 static void _dusMasterPoll(CanasInstance* pi, CanasServicePollCallbackArgs* pargs, SessionEntry* pses)
@@ -426,6 +455,19 @@ static void _dusMasterPoll(CanasInstance* pi, CanasServicePollCallbackArgs* parg
     }
 }
 
+static uint64_t _dusMasterDeadline(const ServiceState* pstate, const SessionEntry* pses)
+{
+    switch (pses->state)
+    {
+    case DUS_MASTER_STATE_SURM_PENDING:
+        return pses->update_timestamp + SDRM_SURM_TIMEOUT_USEC + 1;
+    case DUS_MASTER_STATE_RECEPTION:
+        return pses->update_timestamp + pstate->session_timeout_usec + 1;
+    default:
+        return 0;
+    }
+}
+
 static void _dusMasterResponse(CanasInstance* pi, CanasServiceResponseCallbackArgs* pargs, SessionEntry* pses)
 {
     pses->update_timestamp = pargs->timestamp_usec;
@@ -519,8 +561,7 @@ enum
 
 static void _dusSlaveDone(CanasInstance* pi, SessionEntry* pses)
 {
-    (void)pi;
-    memset(pses, 0, sizeof(*pses));                       // Erase this entry
+    _eraseSession(pi, pses);
 }
 
 static int _dusSlaveTransmitNextChunk(CanasInstance* pi, SessionEntry* pses, bool* plast_chunk)
@@ -629,6 +670,20 @@ static void _dusSlavePoll(CanasInstance* pi, CanasServicePollCallbackArgs* pargs
     }
 }
 
+static uint64_t _dusSlaveDeadline(const ServiceState* pstate, const SessionEntry* pses)
+{
+    switch (pses->state)
+    {
+    case DUS_SLAVE_STATE_INITIAL_DELAY:
+        return pses->update_timestamp + DUS_SLAVE_INITIAL_DELAY_USEC;
+    case DUS_SLAVE_STATE_TRANSMISSION:
+    case DUS_SLAVE_STATE_CHECKSUM:
+        return pses->update_timestamp + pstate->tx_interval_usec;
+    default:
+        return 0;
+    }
+}
+
 static void _dusSlaveRequest(CanasInstance* pi, CanasServiceRequestCallbackArgs* pargs, SessionEntry* pses)
 {
     (void)pi;
@@ -650,6 +705,37 @@ static void (*_poll_handlers[])(CanasInstance*, CanasServicePollCallbackArgs*, S
     _dusSlavePoll
 };
 
+static uint64_t (*_deadline_handlers[])(const ServiceState*, const SessionEntry*) =
+{
+    NULL,
+    _ddsMasterDeadline,
+    _ddsSlaveDeadline,
+    _dusMasterDeadline,
+    _dusSlaveDeadline
+};
+
+static void _onSessionTimer(CanasInstance* pi, CanasTimer* ptimer, uint64_t timestamp_usec);
+
+/**
+ * Must be called whenever the session may have changed its state or its update timestamp.
+ */
+static void _scheduleSession(CanasInstance* pi, ServiceState* pstate, SessionEntry* pses)
+{
+    if (pses->type == SESSION_TYPE_NONE || pses->type >= SESSION_TYPE_BOUND_)
+        return;
+    canasTimerStart(pi, &pses->timer, _deadline_handlers[pses->type](pstate, pses), _onSessionTimer, pstate);
+}
+
+static void _onSessionTimer(CanasInstance* pi, CanasTimer* ptimer, uint64_t timestamp_usec)
+{
+    SessionEntry* pses = (SessionEntry*)ptimer;
+    CanasServicePollCallbackArgs args;
+    args.pstate = ptimer->parg;
+    args.timestamp_usec = timestamp_usec;
+    _poll_handlers[pses->type](pi, &args, pses);
+    _scheduleSession(pi, (ServiceState*)args.pstate, pses);
+}
+
 static SessionEntry* _allocateSession(ServiceState* pstate)
 {
     for (int i = 0; i < pstate->entry_count; i++)
@@ -702,30 +788,10 @@ static void _initSlaveSession(CanasInstance* pi, CanasServiceRequestCallbackArgs
     if (result != 0)
     {
         CANAS_TRACE("srv data init slave: srv %i failed with error %i\n", (int)pargs->message.service_code, result);
-        memset(pnewses, 0, sizeof(*pnewses));
-    }
-}
-
-static void _poll(CanasInstance* pi, CanasServicePollCallbackArgs* pargs)
-{
-    ServiceState* pstate = (ServiceState*)pargs->pstate;
-    if (pstate == NULL)
-    {
-        CANAS_TRACE("srv data poll: invalid state pointer\n");
+        _eraseSession(pi, pnewses);
         return;
     }
-    for (int i = 0; i < pstate->entry_count; i++)
-    {
-        uint8_t type = pstate->entries[i].type;
-        if (type == SESSION_TYPE_NONE)
-            continue;
-        if (type >= SESSION_TYPE_BOUND_)
-        {
-            CANAS_TRACE("srv data poll: invalid entry type: %i\n", (int)type);
-            continue;
-        }
-        _poll_handlers[type](pi, pargs, pstate->entries + i);
-    }
+    _scheduleSession(pi, pstate, pnewses);
 }
 
 static void _response(CanasInstance* pi, CanasServiceResponseCallbackArgs* pargs)
@@ -744,11 +810,13 @@ static void _response(CanasInstance* pi, CanasServiceResponseCallbackArgs* pargs
         if (pargs->message.service_code == SERVICE_CODE_DDS && pses->type == SESSION_TYPE_DDS_MASTER)
         {
             _ddsMasterResponse(pi, pargs, pses);
+            _scheduleSession(pi, pstate, pses);
             return;
         }
         if (pargs->message.service_code == SERVICE_CODE_DUS && pses->type == SESSION_TYPE_DUS_MASTER)
         {
             _dusMasterResponse(pi, pargs, pses);
+            _scheduleSession(pi, pstate, pses);
             return;
         }
     }
@@ -775,11 +843,13 @@ static void _request(CanasInstance* pi, CanasServiceRequestCallbackArgs* pargs)
         if (pargs->message.service_code == SERVICE_CODE_DDS && pses->type == SESSION_TYPE_DDS_SLAVE)
         {
             _ddsSlaveRequest(pi, pargs, pses);
+            _scheduleSession(pi, pstate, pses);
             return;
         }
         if (pargs->message.service_code == SERVICE_CODE_DUS && pses->type == SESSION_TYPE_DUS_SLAVE)
         {
             _dusSlaveRequest(pi, pargs, pses);
+            _scheduleSession(pi, pstate, pses);
             return;
         }
     }
@@ -803,7 +873,8 @@ int canasSrvDataInit(CanasInstance* pi, uint8_t max_active_sessions,
     if (!(need_dus || need_dds))
         return -CANAS_ERR_ARGUMENT;
     /*
-     * Both DDS and DUS share the same state
+     * Both DDS and DUS share the same state.
+     * Sessions are driven by their timers, so there is nothing to poll.
      */
     int size = sizeof(ServiceState) + sizeof(SessionEntry) * max_active_sessions;
     ServiceState* ps = canasMalloc(pi, size);
@@ -822,13 +893,13 @@ int canasSrvDataInit(CanasInstance* pi, uint8_t max_active_sessions,
     int ret = 0;
     if (need_dds)
     {
-        ret = canasServiceRegister(pi, SERVICE_CODE_DDS, _poll, _request, _response, ps);
+        ret = canasServiceRegister(pi, SERVICE_CODE_DDS, NULL, _request, _response, ps);
         if (ret != 0)
             goto error_cleanup;
     }
     if (need_dus)
     {
-        ret = canasServiceRegister(pi, SERVICE_CODE_DUS, _poll, _request, _response, ps);
+        ret = canasServiceRegister(pi, SERVICE_CODE_DUS, NULL, _request, _response, ps);
         if (ret != 0)
             goto error_cleanup;
     }
@@ -912,6 +983,7 @@ int canasSrvDdsDownloadTo(CanasInstance* pi, uint8_t node_id, uint32_t memid, co
     pses->callback.dds_master_done = callback;
     pses->callback_arg             = callback_arg;
     pses->memid                    = memid;
+    _scheduleSession(pi, pstate, pses);
     return 0;
 }
 
@@ -970,5 +1042,6 @@ int canasSrvDusUploadFrom(CanasInstance* pi, uint8_t node_id, uint32_t memid, ui
      * rx_message_count is not used here because incoming data transfer will be terminated by the
      * CHKSUM message from the transmitting node.
      */
+    _scheduleSession(pi, pstate, pses);
     return 0;
 }
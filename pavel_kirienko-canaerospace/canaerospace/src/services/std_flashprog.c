@@ -46,6 +46,15 @@ static void _poll(CanasInstance* pi, CanasServicePollCallbackArgs* pargs)
     cb(pi, node_id, true, 0, cb_arg);
 }
 
+static uint64_t _deadline(CanasInstance* pi, void* pstate)
+{
+    (void)pi;
+    const CanasSrvFpsState* ps = (const CanasSrvFpsState*)pstate;
+    if (ps == NULL || ps->pending_request.node_id == 0 || ps->pending_request.callback == NULL)
+        return CANAS_DEADLINE_NONE;
+    return ps->pending_request.deadline + 1;   // Same condition as in the poll callback
+}
+
 static void _response(CanasInstance* pi, CanasServiceResponseCallbackArgs* pargs)
 {
     CanasSrvFpsState* ps = (CanasSrvFpsState*)pargs->pstate;
@@ -123,8 +132,11 @@ int canasSrvFpsInit(CanasInstance* pi, CanasSrvFpsRequestCallback callback)
 
     int ret = canasServiceRegister(pi, THIS_SERVICE_CODE, _poll, _request, _response, ps);
     if (ret != 0)
+    {
         canasFree(pi, ps);
-    return ret;
+        return ret;
+    }
+    return canasServiceSetDeadlineCallback(pi, THIS_SERVICE_CODE, _deadline);
 }
 
 int canasSrvFpsRequest(CanasInstance* pi, uint8_t node_id, uint8_t security_code, CanasSrvFpsResponseCallback callback,
@@ -14,7 +14,7 @@ static const uint8_t THIS_SERVICE_CODE = 0;
 
 typedef struct
 {
-    uint64_t deadline;
+    CanasTimer timer;                              ///< Response timeout
     CanasSrvIdsResponseCallback callback;
     uint8_t node_id;
 } CanasSrvIdsRequestHandle;
@@ -26,28 +26,13 @@ typedef struct
     CanasSrvIdsRequestHandle pending_requests[];
 } CanasSrvIdsData;
 
-static void _poll(CanasInstance* pi, CanasServicePollCallbackArgs* pargs)
+static void _onTimeout(CanasInstance* pi, CanasTimer* ptimer, uint64_t timestamp_usec)
 {
-    CanasSrvIdsData* pd = (CanasSrvIdsData*)pargs->pstate;
-    if (pd == NULL)
-    {
-        CANAS_TRACE("srv ids poll: invalid state pointer\n");
-        return;
-    }
-    // Check timeouts for the all entries
-    for (int i = 0; i < pd->pending_requests_len; i++)
-    {
-        CanasSrvIdsRequestHandle* prh = pd->pending_requests + i;
-        if (prh->node_id != 0)
-        {
-            if (prh->deadline < pargs->timestamp_usec)
-            {
-                if (prh->callback != NULL)
-                    prh->callback(pi, prh->node_id, NULL); // Callback with NULL payload means that request was timed out
-                memset(prh, 0, sizeof(*prh));              // Clear entry
-            }
-        }
-    }
+    (void)timestamp_usec;
+    CanasSrvIdsRequestHandle* prh = (CanasSrvIdsRequestHandle*)ptimer->parg;
+    if (prh->callback != NULL)
+        prh->callback(pi, prh->node_id, NULL);     // Callback with NULL payload means that request was timed out
+    memset(prh, 0, sizeof(*prh));                  // Clear entry; the timer is not pending anymore
 }
 
 static void _response(CanasInstance* pi, CanasServiceResponseCallbackArgs* pargs)
@@ -78,6 +63,7 @@ static void _response(CanasInstance* pi, CanasServiceResponseCallbackArgs* pargs
                 payload.header_type       = pargs->message.data.container.UCHAR4[3];
                 prh->callback(pi, prh->node_id, &payload);
             }
+            canasTimerStop(pi, &prh->timer);
             memset(prh, 0, sizeof(*prh)); // Clear entry
             break; // No need to go further because the next entries may be intended for other responses
             /*
@@ -124,7 +110,8 @@ int canasSrvIdsInit(CanasInstance* pi, const CanasSrvIdsPayload* pself_definitio
     pd->pending_requests_len = max_pending_requests;
     pd->self_definition = *pself_definition;
 
-    int ret = canasServiceRegister(pi, THIS_SERVICE_CODE, _poll, _request, _response, pd);
+    // Timeouts are handled by the timers, so there is nothing to poll
+    int ret = canasServiceRegister(pi, THIS_SERVICE_CODE, NULL, _request, _response, pd);
     if (ret != 0)
         canasFree(pi, pd);
     return ret;
@@ -187,7 +174,7 @@ int canasSrvIdsRequest(CanasInstance* pi, uint8_t node_id, CanasSrvIdsResponseCa
 
             pd->pending_requests[i].node_id  = next_node_id;
             pd->pending_requests[i].callback = callback;
-            pd->pending_requests[i].deadline = deadline;
+            canasTimerStart(pi, &pd->pending_requests[i].timer, deadline, _onTimeout, pd->pending_requests + i);
 
             ids_allocated++;
             next_node_id++;
@@ -206,7 +193,7 @@ int canasSrvIdsRequest(CanasInstance* pi, uint8_t node_id, CanasSrvIdsResponseCa
                 continue;
             pd->pending_requests[i].node_id  = node_id;
             pd->pending_requests[i].callback = callback;
-            pd->pending_requests[i].deadline = deadline;
+            canasTimerStart(pi, &pd->pending_requests[i].timer, deadline, _onTimeout, pd->pending_requests + i);
             okay = true;
             break;
         }
@@ -0,0 +1,224 @@
+/*
+ * Hierarchical timer wheel
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include <stdlib.h>
+#include "timer.h"
+
+#define SLOT_MASK (CANAS_TIMER_WHEEL_SLOTS - 1)
+
+/// Number of ticks covered by the levels from 0 to the given one
+#define SPAN_TICKS(level) (1ull << (CANAS_TIMER_WHEEL_BITS * ((level) + 1)))
+
+#define WHEEL_SPAN_TICKS SPAN_TICKS(CANAS_TIMER_WHEEL_LEVELS - 1)
+
+static inline uint64_t _tickOf(const CanasInstance* pi, uint64_t timestamp_usec)
+{
+    return timestamp_usec / pi->config.service_poll_interval_usec;
+}
+
+static inline int _slotOf(uint64_t tick, int level)
+{
+    return (tick >> (CANAS_TIMER_WHEEL_BITS * level)) & SLOT_MASK;
+}
+
+static void _link(CanasTimer** pphead, CanasTimer* ptimer)
+{
+    ptimer->pnext = *pphead;
+    if (ptimer->pnext != NULL)
+        ptimer->pnext->ppprev = &ptimer->pnext;
+    ptimer->ppprev = pphead;
+    *pphead = ptimer;
+}
+
+static void _unlink(CanasTimer* ptimer)
+{
+    *ptimer->ppprev = ptimer->pnext;
+    if (ptimer->pnext != NULL)
+        ptimer->pnext->ppprev = ptimer->ppprev;
+    ptimer->pnext = NULL;
+    ptimer->ppprev = NULL;
+}
+
+/**
+ * The level is chosen by the distance from the current position of the wheel,
+ * so every timer is cascaded to the lower level before it expires.
+ */
+static void _place(CanasInstance* pi, CanasTimer* ptimer)
+{
+    uint64_t expires = _tickOf(pi, ptimer->deadline_usec);
+    if (expires < pi->timer_tick)
+        expires = pi->timer_tick;                      // Overdue, will fire at the nearest advance
+    if (expires - pi->timer_tick >= WHEEL_SPAN_TICKS)
+        expires = pi->timer_tick + WHEEL_SPAN_TICKS - 1;   // Will be placed again when the wheel gets there
+    int level = 0;
+    while (expires - pi->timer_tick >= SPAN_TICKS(level))
+        level++;
+    _link(&pi->timer_wheel[level][_slotOf(expires, level)], ptimer);
+}
+
+static void _cascade(CanasInstance* pi, int level)
+{
+    CanasTimer** pphead = &pi->timer_wheel[level][_slotOf(pi->timer_tick, level)];
+    while (*pphead != NULL)
+    {
+        CanasTimer* ptimer = *pphead;
+        _unlink(ptimer);
+        _place(pi, ptimer);
+    }
+}
+
+/**
+ * Processes the slot of the current tick. Timers that are not due yet (far ones) are placed back.
+ */
+static void _expire(CanasInstance* pi, uint64_t timestamp_usec)
+{
+    CanasTimer** pphead = &pi->timer_wheel[0][_slotOf(pi->timer_tick, 0)];
+    if (*pphead == NULL)
+        return;
+
+    // The list is detached, so the callbacks can freely start and stop any timers, including the ones from this list
+    CanasTimer* pdue = *pphead;
+    pdue->ppprev = &pdue;
+    *pphead = NULL;
+    CanasTimer* pdeferred = NULL;
+
+    while (pdue != NULL)
+    {
+        CanasTimer* ptimer = pdue;
+        _unlink(ptimer);
+        if (ptimer->deadline_usec > timestamp_usec)
+        {
+            _link(&pdeferred, ptimer);
+            continue;
+        }
+        pi->timer_count--;
+        ptimer->callback(pi, ptimer, timestamp_usec);
+    }
+    while (pdeferred != NULL)
+    {
+        CanasTimer* ptimer = pdeferred;
+        _unlink(ptimer);
+        _place(pi, ptimer);
+    }
+}
+
+/**
+ * Used when the time jumps farther than the wheel can reach, e.g. after a long idle period.
+ */
+static void _rebuild(CanasInstance* pi, uint64_t tick)
+{
+    CanasTimer* pall = NULL;
+    for (int level = 0; level < CANAS_TIMER_WHEEL_LEVELS; level++)
+    {
+        for (int slot = 0; slot < CANAS_TIMER_WHEEL_SLOTS; slot++)
+        {
+            while (pi->timer_wheel[level][slot] != NULL)
+            {
+                CanasTimer* ptimer = pi->timer_wheel[level][slot];
+                _unlink(ptimer);
+                _link(&pall, ptimer);
+            }
+        }
+    }
+    pi->timer_tick = tick;
+    while (pall != NULL)
+    {
+        CanasTimer* ptimer = pall;
+        _unlink(ptimer);
+        _place(pi, ptimer);
+    }
+}
+
+void canasTimerWheelAdvance(CanasInstance* pi, uint64_t timestamp_usec)
+{
+    const uint64_t target = _tickOf(pi, timestamp_usec);
+    if (pi->timer_count > 0 && target > pi->timer_tick && (target - pi->timer_tick) >= WHEEL_SPAN_TICKS)
+        _rebuild(pi, target);
+
+    while (pi->timer_tick < target)
+    {
+        if (pi->timer_count == 0)
+        {
+            pi->timer_tick = target;                   // Nothing to cascade, just jump
+            return;
+        }
+        _expire(pi, timestamp_usec);
+        pi->timer_tick++;
+        for (int level = 1; level < CANAS_TIMER_WHEEL_LEVELS; level++)
+        {
+            if (_slotOf(pi->timer_tick, level - 1) != 0)
+                break;
+            _cascade(pi, level);
+        }
+    }
+    _expire(pi, timestamp_usec);
+}
+
+uint64_t canasTimerWheelNextDeadline(const CanasInstance* pi)
+{
+    if (pi->timer_count == 0)
+        return CANAS_DEADLINE_NONE;
+
+    // Nearest cascade that may bring some timers down to the first level
+    uint64_t next_tick = UINT64_MAX;
+    for (int level = 1; level < CANAS_TIMER_WHEEL_LEVELS; level++)
+    {
+        const uint64_t block = pi->timer_tick >> (CANAS_TIMER_WHEEL_BITS * level);
+        for (int i = 1; i <= CANAS_TIMER_WHEEL_SLOTS; i++)
+        {
+            if (pi->timer_wheel[level][(block + i) & SLOT_MASK] != NULL)
+            {
+                const uint64_t cascade_tick = (block + i) << (CANAS_TIMER_WHEEL_BITS * level);
+                next_tick = (cascade_tick < next_tick) ? cascade_tick : next_tick;
+                break;
+            }
+        }
+    }
+    uint64_t deadline = CANAS_DEADLINE_NONE;
+    if (next_tick != UINT64_MAX)
+        deadline = next_tick * pi->config.service_poll_interval_usec;
+
+    // Timers of the nearest non-empty slot of the first level are checked one by one
+    for (int i = 0; i < CANAS_TIMER_WHEEL_SLOTS; i++)
+    {
+        const CanasTimer* ptimer = pi->timer_wheel[0][(pi->timer_tick + i) & SLOT_MASK];
+        if (ptimer == NULL)
+            continue;
+        for (; ptimer != NULL; ptimer = ptimer->pnext)
+            deadline = (ptimer->deadline_usec < deadline) ? ptimer->deadline_usec : deadline;
+        break;
+    }
+    return deadline;
+}
+
+int canasTimerStart(CanasInstance* pi, CanasTimer* ptimer, uint64_t deadline_usec, CanasTimerCallbackFn callback,
+                    void* parg)
+{
+    if (pi == NULL || ptimer == NULL || callback == NULL)
+        return -CANAS_ERR_ARGUMENT;
+
+    if (ptimer->ppprev != NULL)
+        _unlink(ptimer);
+    else
+        pi->timer_count++;
+    ptimer->deadline_usec = deadline_usec;
+    ptimer->callback = callback;
+    ptimer->parg = parg;
+    _place(pi, ptimer);
+    return 0;
+}
+
+void canasTimerStop(CanasInstance* pi, CanasTimer* ptimer)
+{
+    if (pi == NULL || ptimer == NULL || ptimer->ppprev == NULL)
+        return;
+    _unlink(ptimer);
+    pi->timer_count--;
+}
+
+bool canasTimerIsPending(const CanasTimer* ptimer)
+{
+    return ptimer != NULL && ptimer->ppprev != NULL;
+}
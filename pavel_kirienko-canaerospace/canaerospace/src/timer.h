@@ -0,0 +1,31 @@
+/*
+ * Hierarchical timer wheel
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#ifndef CANAEROSPACE_TIMER_H_
+#define CANAEROSPACE_TIMER_H_
+
+#include <stdint.h>
+#include <canaerospace/canaerospace.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Fires the timers whose deadlines are not later than the timestamp.
+ * Cost is proportional to the number of ticks passed and the number of expired timers.
+ */
+void canasTimerWheelAdvance(CanasInstance* pi, uint64_t timestamp_usec);
+
+/**
+ * Returns the time of the next event in the wheel, or @ref CANAS_DEADLINE_NONE.
+ * This may be earlier than the nearest deadline if the wheel needs to cascade before that.
+ */
+uint64_t canasTimerWheelNextDeadline(const CanasInstance* pi);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
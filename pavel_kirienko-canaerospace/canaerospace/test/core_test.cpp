@@ -72,7 +72,7 @@ TEST(CoreTest, ParamReception) // Feed one frame, make sure that it appears both
 
     EXPECT_EQ(-CANAS_ERR_BAD_REDUND_CHAN, canasParamSubscribe(&inst, 123, 0, cbParam, NULL)); // Invalid redund chan
     EXPECT_EQ(0, canasParamSubscribe(&inst, 123, 8, cbParam, NULL));
-    EXPECT_EQ(1, mem_chunks.size());                                       // One chunk for one subscription
+    EXPECT_EQ(2, mem_chunks.size());                                       // Service history and one subscription
 
     // Fire:
     cbcnt_param = cbcnt_hook = 0;
@@ -120,7 +120,46 @@ TEST(CoreTest, ParamReception) // Feed one frame, make sure that it appears both
     EXPECT_EQ(0, canasParamUnsubscribe(&inst, 123));
     EXPECT_EQ(-CANAS_ERR_NO_SUCH_ENTRY, canasParamUnsubscribe(&inst, 8));
     EXPECT_EQ(-CANAS_ERR_NO_SUCH_ENTRY, canasParamUnsubscribe(&inst, 123));
-    EXPECT_EQ(0, mem_chunks.size());
+    EXPECT_EQ(1, mem_chunks.size());                                       // Service history stays
+}
+
+TEST(CoreTest, ParamReceptionRef)
+{
+    CanasInstance inst = makeGenericInstance();
+    inst.config.fn_hook_ref = cbHookRef;
+    EXPECT_EQ(0, canasParamSubscribeRef(&inst, 123, 8, cbParamRef, &inst));
+
+    cbcnt_param = cbcnt_param_ref = cbcnt_hook = cbcnt_hook_ref = 0;
+    CanasCanFrame frm = makeFrame(123, 3, 90, CANAS_DATATYPE_ACHAR2, 0, 1, 'a', 'b');
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 1, &frm, 10));
+    EXPECT_EQ(0, cbcnt_param);
+    EXPECT_EQ(1, cbcnt_param_ref);
+    EXPECT_EQ(1, cbcnt_hook);                                   // Both hooks are called
+    EXPECT_EQ(1, cbcnt_hook_ref);
+
+    EXPECT_EQ(1, cbargs_hook_ref.iface);
+    EXPECT_EQ(123, cbargs_hook_ref.message_id);
+    EXPECT_EQ(3, cbargs_hook_ref.redund_channel_id);
+    EXPECT_EQ(10, cbargs_hook_ref.timestamp_usec);
+    EXPECT_EQ(0, memcmp(&cbmsg_hook_ref, &cbargs_hook.message, sizeof(CanasMessage)));
+
+    EXPECT_TRUE(cbargs_param_ref.parg == &inst);
+    EXPECT_EQ(123, cbargs_param_ref.message_id);
+    EXPECT_EQ(3, cbargs_param_ref.redund_channel_id);
+    EXPECT_EQ(10, cbentry_param_ref.timestamp_usec);
+    EXPECT_EQ(90, cbentry_param_ref.message.node_id);
+    EXPECT_EQ('a', cbentry_param_ref.message.data.container.ACHAR2[0]);
+    EXPECT_EQ('b', cbentry_param_ref.message.data.container.ACHAR2[1]);
+
+    // The entry must point right into the cache:
+    CanasParamCallbackArgs args;
+    EXPECT_EQ(0, canasParamRead(&inst, 123, 3, &args));
+    EXPECT_EQ(0, memcmp(&args.message, &cbentry_param_ref.message, sizeof(CanasMessage)));
+
+    // Repetitions are filtered as usual:
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 2, &frm, 11));
+    EXPECT_EQ(1, cbcnt_param_ref);
+    EXPECT_EQ(2, cbcnt_hook_ref);
 }
 
 TEST(CoreTest, RepeatedParamFiltering)
@@ -139,6 +178,148 @@ TEST(CoreTest, RepeatedParamFiltering)
     EXPECT_EQ(3, cbcnt_hook);                                   // Hook must reflect every message, including repeated.
 }
 
+TEST(CoreTest, UninterestingParamRejection)
+{
+    CanasInstance inst = makeGenericInstance();
+    inst.config.fn_hook = NULL;               // Hook wants to see everything, so it must be disabled here
+    EXPECT_EQ(0, canasParamSubscribe(&inst, 123, 1, cbParam, NULL));
+
+    // Nobody is interested, so even malformed frames are accepted:
+    CanasCanFrame frm = makeFrame(124, 0, 90, CANAS_DATATYPE_CHAR2, 0, 1, 'a');
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm, 1));
+
+    frm = makeFrame(123, 0, 90, CANAS_DATATYPE_CHAR2, 0, 1, 'a');
+    EXPECT_EQ(-CANAS_ERR_BAD_DATA_TYPE, _canasUpdateWithTimestamp(&inst, 0, &frm, 1));
+
+    // Services and unknown IDs are not affected:
+    frm = makeFrame(CANAS_MSGTYPE_NODE_SERVICE_HIGH_MIN, 0, 90, CANAS_DATATYPE_CHAR2, 0, 1, 'a');
+    EXPECT_EQ(-CANAS_ERR_BAD_DATA_TYPE, _canasUpdateWithTimestamp(&inst, 0, &frm, 1));
+    frm = makeFrame(CANAS_MSGTYPE_NODE_SERVICE_LOW_MAX + 1, 0, 90, CANAS_DATATYPE_NODATA, 0, 1);
+    EXPECT_EQ(-CANAS_ERR_BAD_MESSAGE_ID, _canasUpdateWithTimestamp(&inst, 0, &frm, 1));
+
+    cbcnt_param = 0;
+    frm = makeFrame(123, 0, 90, CANAS_DATATYPE_UCHAR, 0, 1, 10);
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm, 1));
+    EXPECT_EQ(1, cbcnt_param);
+
+    // Same ID must be rejected once unsubscribed:
+    EXPECT_EQ(0, canasParamUnsubscribe(&inst, 123));
+    frm = makeFrame(123, 0, 90, CANAS_DATATYPE_CHAR2, 0, 2, 'a');
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm, 1));
+}
+
+TEST(CoreTest, UpdateAt)
+{
+    EXPECT_EQ(-CANAS_ERR_ARGUMENT, canasUpdate(NULL, 0, NULL));   // Must not call the clock through NULL
+    EXPECT_EQ(-CANAS_ERR_ARGUMENT, canasUpdateAt(NULL, 0, NULL, 1));
+
+    CanasInstance inst = makeGenericInstance();
+    EXPECT_EQ(0, canasParamSubscribe(&inst, 123, 1, cbParam, NULL));
+    EXPECT_EQ(0, canasServiceRegister(&inst, 8, cbSrvPoll, NULL, NULL, &inst));
+
+    CanasCanFrame frm = makeFrame(123, 0, 90, CANAS_DATATYPE_UCHAR, 0, 1, 10);
+    EXPECT_EQ(-CANAS_ERR_ARGUMENT, canasUpdateAt(&inst, IFACE_COUNT, &frm, 1));
+
+    // Clock must be ignored:
+    current_timestamp = 1;
+    cbcnt_param = cbcnt_srv_poll = 0;
+    EXPECT_EQ(0, canasUpdateAt(&inst, 0, &frm, 5000000));
+    EXPECT_EQ(1, cbcnt_param);
+    EXPECT_EQ(5000000, cbargs_param.timestamp_usec);
+    EXPECT_EQ(5000000, cbargs_hook.timestamp_usec);
+    EXPECT_EQ(1, cbcnt_srv_poll);
+    EXPECT_EQ(5000000, cbargs_srv_poll.timestamp_usec);
+
+    // Repetition detection relies on the supplied timestamps as well:
+    EXPECT_EQ(0, canasUpdateAt(&inst, 1, &frm, 5000001));
+    EXPECT_EQ(1, cbcnt_param);
+    EXPECT_EQ(0, canasUpdateAt(&inst, 1, &frm, 5000000 + inst.config.repeat_timeout_usec + 1));
+    EXPECT_EQ(2, cbcnt_param);
+
+    CanasParamCallbackArgs args;
+    EXPECT_EQ(0, canasParamRead(&inst, 123, 0, &args));
+    EXPECT_EQ(5000000 + inst.config.repeat_timeout_usec + 1, args.timestamp_usec);
+}
+
+TEST(CoreTest, FrameTimestamp)
+{
+    CanasInstance inst = makeGenericInstance();
+    EXPECT_EQ(0, canasParamSubscribe(&inst, 123, 1, cbParam, NULL));
+    EXPECT_EQ(0, canasServiceRegister(&inst, 8, cbSrvPoll, NULL, NULL, &inst));
+
+    // Driver-provided timestamp takes precedence over the clock, but not for the services:
+    CanasCanFrame frm = makeFrame(123, 0, 90, CANAS_DATATYPE_UCHAR, 0, 1, 10);
+    frm.timestamp_usec = 4000000;
+    current_timestamp = 5000000;
+    cbcnt_param = cbcnt_srv_poll = 0;
+    EXPECT_EQ(0, canasUpdate(&inst, 0, &frm));
+    EXPECT_EQ(1, cbcnt_param);
+    EXPECT_EQ(4000000, cbargs_param.timestamp_usec);
+    EXPECT_EQ(4000000, cbargs_hook.timestamp_usec);
+    EXPECT_EQ(1, cbcnt_srv_poll);
+    EXPECT_EQ(5000000, cbargs_srv_poll.timestamp_usec);
+
+    // Explicit time takes precedence over the driver:
+    frm.data[3]++;
+    EXPECT_EQ(0, canasUpdateAt(&inst, 0, &frm, 6000000));
+    EXPECT_EQ(2, cbcnt_param);
+    EXPECT_EQ(6000000, cbargs_param.timestamp_usec);
+
+    // Zero means unknown:
+    frm.data[3]++;
+    frm.timestamp_usec = 0;
+    EXPECT_EQ(0, canasUpdateAt(&inst, 0, &frm, 7000000));
+    EXPECT_EQ(3, cbcnt_param);
+    EXPECT_EQ(7000000, cbargs_param.timestamp_usec);
+
+    // Batch uses the driver time as well:
+    frm.data[3]++;
+    frm.timestamp_usec = 7500000;
+    current_timestamp = 8000000;
+    const uint8_t iface = 0;
+    EXPECT_EQ(0, canasUpdateBatch(&inst, &frm, &iface, 1));
+    EXPECT_EQ(4, cbcnt_param);
+    EXPECT_EQ(7500000, cbargs_param.timestamp_usec);
+}
+
+TEST(CoreTest, UpdateBatch)
+{
+    CanasInstance inst = makeGenericInstance();
+    EXPECT_EQ(0, canasParamSubscribe(&inst, 123, 8, cbParam, NULL));
+    EXPECT_EQ(0, canasServiceRegister(&inst, 8, cbSrvPoll, cbSrvRequest, cbSrvResponse, &inst));
+
+    CanasCanFrame frames[4];
+    uint8_t ifaces[4] = { 0, 1, 2, 0 };
+    frames[0] = makeFrame(123, 0, 90, CANAS_DATATYPE_UCHAR, 0, 1, 10);
+    frames[1] = makeFrame(123, 0, 90, CANAS_DATATYPE_UCHAR, 0, 1, 10);      // Repeated on another iface
+    frames[2] = makeFrame(123, 0, 90, CANAS_DATATYPE_CHAR2, 0, 2, 'a');     // Malformed
+    frames[3] = makeFrame(123, 0, 90, CANAS_DATATYPE_UCHAR, 0, 3, 30);
+
+    EXPECT_EQ(-CANAS_ERR_ARGUMENT, canasUpdateBatch(NULL, frames, ifaces, 4));
+    EXPECT_EQ(-CANAS_ERR_ARGUMENT, canasUpdateBatch(&inst, NULL, ifaces, 4));
+    EXPECT_EQ(-CANAS_ERR_ARGUMENT, canasUpdateBatch(&inst, frames, NULL, 4));
+    EXPECT_EQ(-CANAS_ERR_ARGUMENT, canasUpdateBatch(&inst, frames, ifaces, -1));
+
+    cbcnt_param = cbcnt_hook = cbcnt_srv_poll = 0;
+    current_timestamp = 1000000;
+    EXPECT_EQ(-CANAS_ERR_BAD_DATA_TYPE, canasUpdateBatch(&inst, frames, ifaces, 4));
+    EXPECT_EQ(2, cbcnt_param);                              // Repeated and malformed frames were rejected
+    EXPECT_EQ(3, cbcnt_hook);
+    EXPECT_EQ(1, cbcnt_srv_poll);                           // Once per batch
+    EXPECT_EQ(30, cbargs_param.message.data.container.UCHAR);   // Order was preserved
+    EXPECT_EQ(1000000, cbargs_param.timestamp_usec);
+
+    ifaces[0] = IFACE_COUNT;                                // Bad iface, the rest must be processed anyway
+    frames[3] = makeFrame(123, 0, 90, CANAS_DATATYPE_UCHAR, 0, 4, 40);
+    EXPECT_EQ(-CANAS_ERR_ARGUMENT, canasUpdateBatch(&inst, frames, ifaces, 4));
+    EXPECT_EQ(3, cbcnt_param);
+    EXPECT_EQ(40, cbargs_param.message.data.container.UCHAR);
+
+    current_timestamp = 2000000;
+    EXPECT_EQ(0, canasUpdateBatch(&inst, NULL, NULL, 0));   // Empty batch just polls the services
+    EXPECT_EQ(2, cbcnt_srv_poll);
+}
+
 TEST(CoreTest, ParamPublication) // Publish a message and check that correct frame has been emitted
 {
     CanasInstance inst = makeGenericInstance();
@@ -203,6 +384,201 @@ TEST(CoreTest, ParamPublicationWithInterlacing)
     }
 }
 
+namespace
+{
+    void cbParamPublishBack(CanasInstance* pi, CanasParamCallbackArgs* pargs)
+    {
+        EXPECT_EQ(0, canasParamPublish(pi, 124, &pargs->message.data, 0));
+    }
+
+    void resetSendMany()
+    {
+        std::fill(iface_send_counter, iface_send_counter + IFACE_COUNT, 0);
+        std::fill(iface_send_return_values, iface_send_return_values + IFACE_COUNT, 1);
+        std::fill(iface_send_many_counter, iface_send_many_counter + IFACE_COUNT, 0);
+        std::fill(iface_send_many_return_values, iface_send_many_return_values + IFACE_COUNT, 0);
+        FOR_EACH_IFACE(i)
+            iface_send_many_dump[i].clear();
+    }
+}
+
+TEST(CoreTest, BatchedTransmission)
+{
+    CanasInstance inst = makeGenericInstance();
+    inst.config.fn_send_many = drvSendMany;
+    EXPECT_EQ(0, canasParamAdvertise(&inst, 123, false));
+    EXPECT_EQ(0, canasParamAdvertise(&inst, 124, false));
+    EXPECT_EQ(0, canasParamAdvertise(&inst, 125, true));
+
+    CanasMessageData data;
+    memset(&data, 0, sizeof(data));
+    data.type = CANAS_DATATYPE_UCHAR;
+
+    // No batching outside of the brackets:
+    resetSendMany();
+    EXPECT_EQ(0, canasParamPublish(&inst, 123, &data, 0));
+    EXPECT_EQ(1, iface_send_counter[0]);
+    EXPECT_EQ(0, iface_send_many_counter[0]);
+    EXPECT_EQ(-CANAS_ERR_ARGUMENT, canasTxEnd(&inst));       // Unbalanced
+    EXPECT_EQ(-CANAS_ERR_ARGUMENT, canasTxBegin(NULL));
+
+    // Nesting is limited; the update still works when the application has taken all the levels:
+    for (int i = 0; i < CANAS_TX_MAX_DEPTH; i++)
+        EXPECT_EQ(0, canasTxBegin(&inst));
+    EXPECT_EQ(-CANAS_ERR_QUOTA_EXCEEDED, canasTxBegin(&inst));
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, NULL, 1));
+    for (int i = 0; i < CANAS_TX_MAX_DEPTH; i++)
+        EXPECT_EQ(0, canasTxEnd(&inst));
+    EXPECT_EQ(-CANAS_ERR_ARGUMENT, canasTxEnd(&inst));
+
+    // Nested brackets, interlaced frame goes to the first iface only:
+    resetSendMany();
+    canasTxBegin(&inst);
+    EXPECT_EQ(0, canasParamPublish(&inst, 123, &data, 0));
+    canasTxBegin(&inst);
+    EXPECT_EQ(0, canasParamPublish(&inst, 124, &data, 0));
+    EXPECT_EQ(0, canasParamPublish(&inst, 125, &data, 0));
+    EXPECT_EQ(0, canasTxEnd(&inst));
+    FOR_EACH_IFACE(i)
+        EXPECT_EQ(0, iface_send_many_counter[i]);
+    EXPECT_EQ(0, canasTxEnd(&inst));
+    FOR_EACH_IFACE(i)
+    {
+        EXPECT_EQ(0, iface_send_counter[i]);
+        EXPECT_EQ(1, iface_send_many_counter[i]);
+        EXPECT_EQ((i == 0) ? 3 : 2, int(iface_send_many_dump[i].size()));
+        EXPECT_EQ(123, iface_send_many_dump[i][0].id);
+        EXPECT_EQ(124, iface_send_many_dump[i][1].id);
+    }
+    EXPECT_EQ(125, iface_send_many_dump[0][2].id);
+
+    // Frames sent from the callbacks are flushed at the end of the update:
+    resetSendMany();
+    EXPECT_EQ(0, canasParamSubscribe(&inst, 200, 1, cbParamPublishBack, NULL));
+    CanasCanFrame frm = makeFrame(200, 0, 90, CANAS_DATATYPE_UCHAR, 0, 1, 10);
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm, 1));
+    FOR_EACH_IFACE(i)
+    {
+        EXPECT_EQ(0, iface_send_counter[i]);
+        ASSERT_EQ(1, int(iface_send_many_dump[i].size()));
+        EXPECT_EQ(124, iface_send_many_dump[i][0].id);
+        EXPECT_EQ(10, iface_send_many_dump[i][0].data[4]);
+    }
+
+    // Overflow causes early flush:
+    resetSendMany();
+    canasTxBegin(&inst);
+    for (int i = 0; i < CANAS_TX_QUEUE_LEN + 1; i++)
+        EXPECT_EQ(0, canasParamPublish(&inst, 123, &data, 0));
+    EXPECT_EQ(1, iface_send_many_counter[0]);
+    EXPECT_EQ(CANAS_TX_QUEUE_LEN, int(iface_send_many_dump[0].size()));
+    EXPECT_EQ(0, canasTxEnd(&inst));
+    EXPECT_EQ(2, iface_send_many_counter[0]);
+    EXPECT_EQ(CANAS_TX_QUEUE_LEN + 1, int(iface_send_many_dump[0].size()));
+
+    // Errors are reported by the flush; one good iface is enough:
+    resetSendMany();
+    std::fill(iface_send_return_values, iface_send_return_values + IFACE_COUNT, 0);
+    iface_send_many_return_values[0] = -1;
+    iface_send_many_return_values[1] = -1;
+    canasTxBegin(&inst);
+    EXPECT_EQ(0, canasParamPublish(&inst, 123, &data, 0));
+    EXPECT_EQ(0, canasTxEnd(&inst));
+    iface_send_many_return_values[2] = -1;
+    canasTxBegin(&inst);
+    EXPECT_EQ(0, canasParamPublish(&inst, 123, &data, 0));
+    EXPECT_EQ(-CANAS_ERR_DRIVER, canasTxEnd(&inst));
+
+    // Failure of the early flush is not forgotten even if the final flush succeeds:
+    resetSendMany();
+    std::fill(iface_send_return_values, iface_send_return_values + IFACE_COUNT, 0);
+    std::fill(iface_send_many_return_values, iface_send_many_return_values + IFACE_COUNT, -1);
+    canasTxBegin(&inst);
+    for (int i = 0; i < CANAS_TX_QUEUE_LEN + 1; i++)                // The last one flushes the full queue
+        EXPECT_EQ(0, canasParamPublish(&inst, 123, &data, 0));
+    EXPECT_EQ(1, iface_send_many_counter[0]);
+    std::fill(iface_send_many_return_values, iface_send_many_return_values + IFACE_COUNT, 0);
+    EXPECT_EQ(0, canasParamPublish(&inst, 124, &data, 0));
+    EXPECT_EQ(-CANAS_ERR_DRIVER, canasTxEnd(&inst));
+    EXPECT_EQ(2, iface_send_many_counter[0]);
+    canasTxBegin(&inst);                                               // The error is reported only once
+    EXPECT_EQ(0, canasParamPublish(&inst, 123, &data, 0));
+    EXPECT_EQ(0, canasTxEnd(&inst));
+
+    // Frames that were not taken as a batch are sent one by one:
+    resetSendMany();
+    std::fill(iface_send_many_return_values, iface_send_many_return_values + IFACE_COUNT, 1);
+    canasTxBegin(&inst);
+    EXPECT_EQ(0, canasParamPublish(&inst, 123, &data, 0));
+    EXPECT_EQ(0, canasParamPublish(&inst, 124, &data, 0));
+    EXPECT_EQ(0, canasTxEnd(&inst));
+    FOR_EACH_IFACE(i)
+    {
+        EXPECT_EQ(1, iface_send_many_counter[i]);
+        EXPECT_EQ(1, iface_send_counter[i]);
+        EXPECT_EQ(124, iface_send_dump[i].id);
+    }
+
+    // Interlaced frame is lost if its only interface refuses it, even though the other frame made it:
+    resetSendMany();
+    std::fill(iface_send_many_return_values, iface_send_many_return_values + IFACE_COUNT, 1);
+    std::fill(iface_send_return_values, iface_send_return_values + IFACE_COUNT, 0);
+    canasTxBegin(&inst);
+    EXPECT_EQ(0, canasParamPublish(&inst, 123, &data, 0));
+    EXPECT_EQ(0, canasParamPublish(&inst, 125, &data, 0));
+    EXPECT_EQ(-CANAS_ERR_DRIVER, canasTxEnd(&inst));
+    int num_single_sends = 0;
+    FOR_EACH_IFACE(i)
+        num_single_sends += iface_send_counter[i];
+    EXPECT_EQ(1, num_single_sends);
+}
+
+TEST(CoreTest, ParamPublicationWithHandle)
+{
+    CanasInstance inst = makeGenericInstance();
+    inst.config.redund_channel_id = 5;
+
+    CanasParamHandle handle = NULL;
+    EXPECT_EQ(-CANAS_ERR_ARGUMENT, canasParamAdvertiseHandle(&inst, 123, false, NULL));
+    EXPECT_EQ(-CANAS_ERR_BAD_MESSAGE_ID, canasParamAdvertiseHandle(&inst, CANAS_MSGTYPE_NODE_SERVICE_LOW_MIN, false,
+                                                                   &handle));
+    EXPECT_EQ(0, canasParamAdvertiseHandle(&inst, 123, false, &handle));
+    CHECKPTR(handle);
+    EXPECT_EQ(-CANAS_ERR_ENTRY_EXISTS, canasParamAdvertiseHandle(&inst, 123, false, &handle));
+
+    CanasMessageData data;
+    memset(&data, 0, sizeof(data));
+    data.container.ULONG = 0xdeadbeef;
+    data.type = CANAS_DATATYPE_ULONG;
+
+    std::fill(iface_send_counter, iface_send_counter + IFACE_COUNT, 0);
+    std::fill(iface_send_return_values, iface_send_return_values + IFACE_COUNT, 1);
+    EXPECT_EQ(-CANAS_ERR_ARGUMENT, canasParamPublishHandle(&inst, NULL, &data, 34));
+    EXPECT_EQ(0, canasParamPublishHandle(&inst, handle, &data, 34));
+
+    CanasCanFrame reference = makeFrame(123, 5, inst.config.node_id, CANAS_DATATYPE_ULONG, 34, 0,
+                                        0xde, 0xad, 0xbe, 0xef);
+    FOR_EACH_IFACE(i)
+    {
+        EXPECT_EQ(1, iface_send_counter[i]);
+        EXPECT_EQ(0, memcmp(iface_send_dump + i, &reference, sizeof(reference)));
+    }
+
+    // Shorter payload must not leave garbage from the previous message; message code goes on:
+    data.container.ACHAR2[0] = 'a';
+    data.container.ACHAR2[1] = 'b';
+    data.type = CANAS_DATATYPE_ACHAR2;
+    EXPECT_EQ(0, canasParamPublish(&inst, 123, &data, 12));
+    reference = makeFrame(123, 5, inst.config.node_id, CANAS_DATATYPE_ACHAR2, 12, 1, 'a', 'b');
+    FOR_EACH_IFACE(i)
+        EXPECT_EQ(0, memcmp(iface_send_dump + i, &reference, sizeof(reference)));
+
+    data.type = CANAS_DATATYPE_RESVD_BEGIN_;
+    EXPECT_EQ(-CANAS_ERR_BAD_DATA_TYPE, canasParamPublishHandle(&inst, handle, &data, 34));
+
+    EXPECT_EQ(0, canasParamUnadvertise(&inst, 123));
+}
+
 TEST(CoreTest, ServiceIgnoring)
 {
     resetMemory();
@@ -249,7 +625,7 @@ TEST(CoreTest, ServiceIgnoring)
     EXPECT_EQ(0, canasServiceUnregister(&inst, 9));
     EXPECT_EQ(0, canasServiceUnregister(&inst, 8));
     EXPECT_EQ(0, canasServiceUnregister(&inst, 10));
-    EXPECT_EQ(0, mem_chunks.size());
+    EXPECT_EQ(1, mem_chunks.size());                                       // Service history stays
 }
 
 TEST(CoreTest, ServicePoll)
@@ -290,6 +666,43 @@ TEST(CoreTest, ServicePoll)
     EXPECT_EQ(0, cbcnt_srv_response);
 }
 
+TEST(CoreTest, NextDeadline)
+{
+    CanasInstance inst = makeGenericInstance();
+    const uint64_t interval = inst.config.service_poll_interval_usec;
+    cbcnt_srv_poll = 0;
+
+    // Nothing to poll:
+    EXPECT_EQ(0, canasServiceRegister(&inst, 10, NULL, NULL, NULL, &inst));
+    EXPECT_EQ(CANAS_DEADLINE_NONE, canasGetNextDeadline(&inst));
+
+    // Service with a deadline callback is idle:
+    uint64_t srv_deadline = CANAS_DEADLINE_NONE;
+    EXPECT_EQ(0, canasServiceRegister(&inst, 8, cbSrvPoll, NULL, NULL, &srv_deadline));
+    EXPECT_EQ(-CANAS_ERR_NO_SUCH_ENTRY, canasServiceSetDeadlineCallback(&inst, 9, cbSrvDeadline));
+    EXPECT_EQ(0, canasServiceSetDeadlineCallback(&inst, 8, cbSrvDeadline));
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, -1, NULL, 1000000));
+    EXPECT_EQ(1, cbcnt_srv_poll);
+    EXPECT_EQ(CANAS_DEADLINE_NONE, canasGetNextDeadline(&inst));
+
+    // Reported deadline is respected, but the poll interval is not violated:
+    srv_deadline = 1500000;
+    EXPECT_EQ(1500000, canasGetNextDeadline(&inst));
+    srv_deadline = 1000001;
+    EXPECT_EQ(1000000 + interval, canasGetNextDeadline(&inst));
+
+    // Updating exactly at the deadline polls the service:
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, -1, NULL, canasGetNextDeadline(&inst)));
+    EXPECT_EQ(2, cbcnt_srv_poll);
+
+    // Service that can't tell is polled periodically:
+    EXPECT_EQ(0, canasServiceRegister(&inst, 9, cbSrvPoll, NULL, NULL, &inst));
+    srv_deadline = CANAS_DEADLINE_NONE;
+    EXPECT_EQ(1000000 + interval * 2, canasGetNextDeadline(&inst));
+
+    EXPECT_EQ(0, canasGetNextDeadline(NULL));
+}
+
 TEST(CoreTest, ServiceReception)
 {
     CanasInstance inst = makeGenericInstance();
@@ -320,6 +733,35 @@ TEST(CoreTest, ServiceReception)
     EXPECT_EQ(1, cbcnt_srv_response);
 }
 
+TEST(CoreTest, ServiceReceptionRef)
+{
+    CanasInstance inst = makeGenericInstance();
+    cbcnt_srv_request = cbcnt_srv_response = cbcnt_srv_request_ref = cbcnt_srv_response_ref = 0;
+
+    EXPECT_EQ(0, canasServiceRegisterRef(&inst, 8, cbSrvPoll, cbSrvRequestRef, cbSrvResponseRef, &inst));
+
+    CanasCanFrame frm = makeFrame(128, 0, MY_NODE_ID, CANAS_DATATYPE_ULONG, 8, 1, 0xde, 0xad, 0xfa, 0xce);
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm, 1));
+    EXPECT_EQ(1, cbcnt_srv_request_ref);
+    EXPECT_EQ(0, cbcnt_srv_response_ref);
+    EXPECT_EQ(0, cbcnt_srv_request);
+
+    EXPECT_TRUE(cbargs_srv_request_ref.pstate == &inst);
+    EXPECT_EQ(0, cbargs_srv_request_ref.service_channel);
+    EXPECT_EQ(1, cbargs_srv_request_ref.timestamp_usec);
+    EXPECT_EQ(0xdeadface, cbmsg_srv_request_ref.data.container.ULONG);
+    EXPECT_EQ(8, cbmsg_srv_request_ref.service_code);
+
+    inst.config.service_channel = 101;
+    frm = makeFrame(2003, 0, MY_NODE_ID + 1, CANAS_DATATYPE_UDEF_BEGIN_, 8, 1);
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm, 2));
+    EXPECT_EQ(1, cbcnt_srv_request_ref);
+    EXPECT_EQ(1, cbcnt_srv_response_ref);
+    EXPECT_EQ(0, cbcnt_srv_response);
+    EXPECT_EQ(MY_NODE_ID + 1, cbmsg_srv_response_ref.node_id);
+    EXPECT_EQ(2, cbargs_srv_response_ref.timestamp_usec);
+}
+
 TEST(CoreTest, ServiceRepetitions)
 {
     CanasInstance inst = makeGenericInstance();
@@ -373,6 +815,82 @@ TEST(CoreTest, ServiceRepetitions)
     EXPECT_EQ(12, cbcnt_hook);
 }
 
+TEST(CoreTest, ServiceRepetitionsShared)
+{
+    CanasInstance inst = makeGenericInstance();
+    cbcnt_srv_request = 0;
+
+    EXPECT_EQ(0, canasServiceRegister(&inst, 8, cbSrvPoll, cbSrvRequest, cbSrvResponse, &inst));
+    EXPECT_EQ(0, canasServiceRegister(&inst, 9, cbSrvPoll, cbSrvRequest, cbSrvResponse, &inst));
+
+    // Frames of different services differ by the service code only; they must not be confused:
+    const CanasCanFrame frm8 = makeFrame(196, 0, MY_NODE_ID, CANAS_DATATYPE_ULONG, 8, 1, 0xde, 0xad, 0xfa, 0xce);
+    const CanasCanFrame frm9 = makeFrame(196, 0, MY_NODE_ID, CANAS_DATATYPE_ULONG, 9, 1, 0xde, 0xad, 0xfa, 0xce);
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm8, 1000));
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm9, 1010));
+    EXPECT_EQ(2, cbcnt_srv_request);
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 1, &frm9, 1020));
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 1, &frm8, 1030));
+    EXPECT_EQ(2, cbcnt_srv_request);
+
+    // Repetitions are not detected without the history:
+    CanasConfig cfg = makeGenericConfig();
+    cfg.service_frame_hist_len = 0;
+    EXPECT_EQ(0, canasInit(&inst, &cfg, NULL));
+    EXPECT_EQ(0, canasServiceRegister(&inst, 8, cbSrvPoll, cbSrvRequest, cbSrvResponse, &inst));
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm8, 1000));
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 1, &frm8, 1010));
+    EXPECT_EQ(4, cbcnt_srv_request);
+}
+
+TEST(CoreTest, Preallocation)
+{
+    resetMemory();
+
+    CanasConfig cfg = makeGenericConfig();
+    cfg.max_param_subscriptions = 3;
+    cfg.max_redund_channels = 2;
+    cfg.max_param_advertisements = 2;
+    cfg.max_services = 1;
+    CanasInstance inst;
+    EXPECT_EQ(0, canasInit(&inst, &cfg, NULL));
+    EXPECT_EQ(1, mem_chunks.size());                       // Everything in one block, including the service history
+
+    // Within the limits, no allocations:
+    EXPECT_EQ(0, canasParamSubscribe(&inst, 100, 1, cbParam, NULL));
+    EXPECT_EQ(0, canasParamSubscribe(&inst, 101, 2, cbParam, NULL));
+    EXPECT_EQ(0, canasParamAdvertise(&inst, 200, false));
+    EXPECT_EQ(0, canasParamAdvertise(&inst, 201, false));
+    EXPECT_EQ(0, canasServiceRegister(&inst, 8, cbSrvPoll, cbSrvRequest, cbSrvResponse, NULL));
+    EXPECT_EQ(1, mem_chunks.size());
+
+    // Too many redundancy channels, and too many entries:
+    EXPECT_EQ(0, canasParamSubscribe(&inst, 102, 3, cbParam, NULL));
+    EXPECT_EQ(0, canasParamSubscribe(&inst, 103, 1, cbParam, NULL));
+    EXPECT_EQ(0, canasParamSubscribe(&inst, 104, 1, cbParam, NULL));
+    EXPECT_EQ(0, canasParamAdvertise(&inst, 202, false));
+    EXPECT_EQ(0, canasServiceRegister(&inst, 9, cbSrvPoll, cbSrvRequest, cbSrvResponse, NULL));
+    EXPECT_EQ(5, mem_chunks.size());
+
+    // The preallocated entries work as usual:
+    CanasCanFrame frm = makeFrame(101, 1, 90, CANAS_DATATYPE_FLOAT, 0, 1, 0, 0, 0, 0);
+    cbcnt_param = 0;
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm, 1000));
+    EXPECT_EQ(1, cbcnt_param);
+    EXPECT_EQ(1, cbargs_param.redund_channel_id);
+
+    // Freed entries go back to where they came from:
+    EXPECT_EQ(0, canasParamUnsubscribe(&inst, 101));
+    EXPECT_EQ(0, canasParamUnsubscribe(&inst, 102));
+    EXPECT_EQ(0, canasParamUnadvertise(&inst, 202));
+    EXPECT_EQ(0, canasServiceUnregister(&inst, 8));
+    EXPECT_EQ(0, canasServiceUnregister(&inst, 9));
+    EXPECT_EQ(2, mem_chunks.size());
+    EXPECT_EQ(0, canasParamSubscribe(&inst, 105, 2, cbParam, NULL));
+    EXPECT_EQ(0, canasServiceRegister(&inst, 10, cbSrvPoll, cbSrvRequest, cbSrvResponse, NULL));
+    EXPECT_EQ(2, mem_chunks.size());
+}
+
 TEST(CoreTest, ServiceState)
 {
     CanasInstance inst = makeGenericInstance();
@@ -0,0 +1,125 @@
+/*
+ * Tests of the typed C++ interface
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include <canaerospace/canaerospace.hpp>
+#include <canaerospace/param_id/param_bindings.hpp>       // Opt-in, includes the ID headers
+#include "test.hpp"
+
+namespace canaerospace
+{
+CANAS_CPP_PARAM_BINDING(1899, CANAS_PARAM_TYPE_BIT(CANAS_DATATYPE_CHAR2))
+}
+
+namespace
+{
+    typedef canaerospace::Param<CANAS_NOD_DEF_BODY_PITCH_RATE, float> PitchRate;
+    typedef canaerospace::Param<CANAS_NOD_DEF_UTC, std::array<int8_t, 4> > Utc;
+    typedef canaerospace::Param<CANAS_UAV_ESC_COMMAND_1, uint16_t> EscCommand;
+    typedef canaerospace::Param<CANAS_NOD_DEF_TRIM_SYSTEM_SWITCHES, uint32_t, CANAS_DATATYPE_BLONG> TrimSwitches;
+    typedef canaerospace::Param<CANAS_NOD_DEF_BODY_PITCH_RATE, std::array<int16_t, 2> > PitchRateShort;
+    typedef canaerospace::Param<1899, std::array<int8_t, 2> > Custom;
+
+    // Wrong types are compile errors:
+    //   canaerospace::Param<CANAS_NOD_DEF_BODY_PITCH_RATE, int32_t>  - FLOAT or SHORT2 only
+    //   canaerospace::Param<CANAS_UAV_ESC_COMMAND_1, uint32_t>       - USHORT only
+    //   canaerospace::Param<CANAS_UAV_ESC_COMMAND_1, double>         - no such data type
+    //   canaerospace::Param<CANAS_UAV_ESC_COMMAND_1, float, CANAS_DATATYPE_SHORT>
+    //   canaerospace::Param<1899, float>                             - bound by the application
+    static_assert(PitchRate::type_id == CANAS_DATATYPE_FLOAT, "");
+    static_assert(PitchRateShort::type_id == CANAS_DATATYPE_SHORT2, "");
+    static_assert(Utc::type_id == CANAS_DATATYPE_CHAR4, "");
+    static_assert(TrimSwitches::type_id == CANAS_DATATYPE_BLONG, "");
+    static_assert(Custom::type_id == CANAS_DATATYPE_CHAR2, "");
+
+    // Standard bindings:
+    static_assert(canaerospace::ParamBinding<CANAS_UAV_ESC_COMMAND_1>::type_id == CANAS_DATATYPE_USHORT, "");
+    static_assert(canaerospace::ParamBinding<CANAS_NOD_DEF_BODY_PITCH_RATE>::type_id == -1, "");
+    static_assert(canaerospace::ParamBinding<CANAS_NOD_DEF_BODY_PITCH_RATE>::type_mask ==
+                  (CANAS_PARAM_TYPE_BIT(CANAS_DATATYPE_FLOAT) | CANAS_PARAM_TYPE_BIT(CANAS_DATATYPE_SHORT2)), "");
+    static_assert(canaerospace::isTypeAllowed<CANAS_NOD_DEF_TRIM_SYSTEM_SWITCHES>(CANAS_DATATYPE_BSHORT), "");
+    static_assert(!canaerospace::isTypeAllowed<CANAS_NOD_DEF_TRIM_SYSTEM_SWITCHES>(CANAS_DATATYPE_LONG), "");
+    static_assert(!canaerospace::isTypeAllowed<CANAS_NOD_DEF_TRIM_SYSTEM_SWITCHES>(CANAS_DATATYPE_UDEF_BEGIN_), "");
+    static_assert(canaerospace::isTypeAllowed<1898>(CANAS_DATATYPE_UDEF_BEGIN_), "");   // Unbound
+}
+
+TEST(CppApiTest, EncodeDecode)
+{
+    const CanasMessageData pitch = PitchRate::encode(-1.25f);
+    EXPECT_EQ(CANAS_DATATYPE_FLOAT, pitch.type);
+    EXPECT_FLOAT_EQ(-1.25f, pitch.container.FLOAT);
+
+    const std::array<int8_t, 4> hms = {{ 12, 34, 56, 0 }};
+    const CanasMessageData utc = Utc::encode(hms);
+    EXPECT_EQ(CANAS_DATATYPE_CHAR4, utc.type);
+    EXPECT_EQ(34, utc.container.CHAR4[1]);
+
+    std::array<int8_t, 4> hms_decoded = {{ 0, 0, 0, 0 }};
+    EXPECT_TRUE(Utc::decode(utc, hms_decoded));
+    EXPECT_TRUE(hms == hms_decoded);
+
+    float value = 0;
+    EXPECT_TRUE(PitchRate::decode(pitch, value));
+    EXPECT_FLOAT_EQ(-1.25f, value);
+    EXPECT_FALSE(PitchRate::decode(utc, value));        // Wrong type, untouched
+    EXPECT_FLOAT_EQ(-1.25f, value);
+
+    EXPECT_EQ(CANAS_DATATYPE_BLONG, TrimSwitches::encode(0xdeadbeef).type);
+}
+
+TEST(CppApiTest, PublishSubscribe)
+{
+    CanasInstance inst = makeGenericInstance();
+    std::fill(iface_send_return_values, iface_send_return_values + IFACE_COUNT, 1);
+
+    // Publication by ID and by handle:
+    EXPECT_EQ(-CANAS_ERR_NO_SUCH_ENTRY, PitchRate::publish(&inst, 1.0f));
+    EXPECT_EQ(0, PitchRate::advertise(&inst));
+    EXPECT_EQ(0, PitchRate::publish(&inst, 1.0f));
+    EXPECT_EQ(CANAS_NOD_DEF_BODY_PITCH_RATE, int(iface_send_dump[0].id));
+    EXPECT_EQ(CANAS_DATATYPE_FLOAT, iface_send_dump[0].data[1]);
+    EXPECT_EQ(0x3f, iface_send_dump[0].data[4]);        // 1.0f, big endian
+
+    canaerospace::Publisher<EscCommand> esc_pub;
+    EXPECT_EQ(0, esc_pub.advertise(&inst));
+    EXPECT_EQ(0, esc_pub.publish(&inst, 0x1234));
+    EXPECT_EQ(CANAS_UAV_ESC_COMMAND_1, int(iface_send_dump[0].id));
+    EXPECT_EQ(0x12, iface_send_dump[0].data[4]);
+    EXPECT_EQ(0x34, iface_send_dump[0].data[5]);
+
+    // Subscription with a capturing lambda:
+    float last_value = 0;
+    int calls = 0;
+    auto sub = canaerospace::makeSubscriber<PitchRate>(
+        [&](const float& value, const CanasParamCallbackRefArgs& args)
+        {
+            last_value = value;
+            calls++;
+            EXPECT_EQ(CANAS_NOD_DEF_BODY_PITCH_RATE, args.message_id);
+        });
+    EXPECT_EQ(0, sub.subscribe(&inst, 2));
+
+    CanasCanFrame frm = makeFrame(CANAS_NOD_DEF_BODY_PITCH_RATE, 1, 90, CANAS_DATATYPE_FLOAT, 0, 1,
+                                  0x40, 0x20, 0x00, 0x00);   // 2.5f
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm, 1000));
+    EXPECT_EQ(1, calls);
+    EXPECT_FLOAT_EQ(2.5f, last_value);
+
+    float value = 0;
+    uint64_t timestamp = 0;
+    EXPECT_EQ(0, PitchRate::read(&inst, 1, value, &timestamp));
+    EXPECT_FLOAT_EQ(2.5f, value);
+    EXPECT_EQ(1000, timestamp);
+
+    // Wrong data type from the bus is dropped:
+    frm = makeFrame(CANAS_NOD_DEF_BODY_PITCH_RATE, 0, 90, CANAS_DATATYPE_SHORT, 0, 2, 0x00, 0x01);
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm, 2000));
+    EXPECT_EQ(1, calls);
+    EXPECT_EQ(1, int(sub.getTypeErrorCount()));
+    EXPECT_EQ(-CANAS_ERR_BAD_DATA_TYPE, PitchRate::read(&inst, 0, value));
+
+    EXPECT_EQ(0, sub.unsubscribe(&inst));
+    EXPECT_EQ(0, PitchRate::unadvertise(&inst));
+    EXPECT_EQ(0, esc_pub.unadvertise(&inst));
+}
@@ -0,0 +1,108 @@
+/*
+ * Tests of the service frame history
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include <vector>
+#include "test.hpp"
+#include "../src/history.h"
+
+namespace
+{
+    const uint32_t REPEAT_TIMEOUT = 1000;
+
+    /// Straightforward linear implementation of the same rules
+    struct ReferenceHistory
+    {
+        struct Entry
+        {
+            uint64_t timestamp;
+            uint32_t header;
+            uint8_t ifaces_mask;
+        };
+        std::vector<Entry> entries;   // Oldest first
+        unsigned len;
+
+        explicit ReferenceHistory(unsigned len) : len(len) { }
+
+        bool check(uint32_t header, uint8_t iface, uint64_t timestamp)
+        {
+            for (unsigned i = 0; i < entries.size(); i++)
+            {
+                Entry& e = entries[i];
+                if (e.header == header && (timestamp - e.timestamp) <= REPEAT_TIMEOUT &&
+                    !(e.ifaces_mask & (1 << iface)))
+                {
+                    e.ifaces_mask |= 1 << iface;
+                    return true;
+                }
+            }
+            if (len == 0)
+                return false;
+            if (entries.size() == len)
+                entries.erase(entries.begin());
+            Entry e = { timestamp, header, uint8_t(1 << iface) };
+            entries.push_back(e);
+            return false;
+        }
+    };
+
+    void compareWithReference(uint8_t len, int num_headers)
+    {
+        std::vector<CanasServiceFrameHistoryEntry> entries(len + 1);
+        std::vector<uint8_t> slots(canasHistorySlotCount(len));
+        CanasServiceHistory hist;
+        canasHistoryInit(&hist, &entries[0], &slots[0], len);
+        ReferenceHistory ref(len);
+
+        uint64_t timestamp = 1;
+        for (int i = 0; i < 100000; i++)
+        {
+            timestamp += std::rand() % 50;
+            const uint32_t header = 0x10203040 + (std::rand() % num_headers) * 0x01000000;
+            const uint8_t iface = std::rand() % 3;
+            ASSERT_EQ(ref.check(header, iface, timestamp),
+                      canasHistoryCheckRepetition(&hist, header, iface, timestamp, REPEAT_TIMEOUT))
+                << "len=" << int(len) << " step=" << i;
+        }
+    }
+}
+
+TEST(HistoryTest, SlotCount)
+{
+    EXPECT_EQ(1, canasHistorySlotCount(0));
+    EXPECT_EQ(2, canasHistorySlotCount(1));
+    EXPECT_EQ(64, canasHistorySlotCount(32));
+    EXPECT_EQ(128, canasHistorySlotCount(33));
+    EXPECT_EQ(512, canasHistorySlotCount(255));
+}
+
+TEST(HistoryTest, Basic)
+{
+    CanasServiceFrameHistoryEntry entries[2];
+    uint8_t slots[4];
+    CanasServiceHistory hist;
+    canasHistoryInit(&hist, entries, slots, 2);
+
+    EXPECT_FALSE(canasHistoryCheckRepetition(&hist, 0xAA, 0, 100, REPEAT_TIMEOUT));
+    EXPECT_TRUE(canasHistoryCheckRepetition(&hist, 0xAA, 1, 200, REPEAT_TIMEOUT));
+    EXPECT_FALSE(canasHistoryCheckRepetition(&hist, 0xAA, 1, 300, REPEAT_TIMEOUT));  // Already seen on this iface
+    EXPECT_FALSE(canasHistoryCheckRepetition(&hist, 0xBB, 1, 400, REPEAT_TIMEOUT));  // Evicts the first 0xAA
+    EXPECT_TRUE(canasHistoryCheckRepetition(&hist, 0xAA, 0, 500, REPEAT_TIMEOUT));   // Matches the second one
+    EXPECT_FALSE(canasHistoryCheckRepetition(&hist, 0xBB, 0, 1401, REPEAT_TIMEOUT)); // Expired
+
+    // Zero length disables the detection
+    canasHistoryInit(&hist, entries, slots, 0);
+    EXPECT_FALSE(canasHistoryCheckRepetition(&hist, 0xAA, 0, 100, REPEAT_TIMEOUT));
+    EXPECT_FALSE(canasHistoryCheckRepetition(&hist, 0xAA, 1, 100, REPEAT_TIMEOUT));
+}
+
+TEST(HistoryTest, Reference)
+{
+    std::srand(42);
+    const uint8_t lens[] = { 1, 2, 5, 32, 255 };
+    const int header_counts[] = { 1, 3, 20, 200 };
+    for (unsigned i = 0; i < sizeof(lens); i++)
+        for (unsigned k = 0; k < sizeof(header_counts) / sizeof(header_counts[0]); k++)
+            compareWithReference(lens[i], header_counts[k]);
+}
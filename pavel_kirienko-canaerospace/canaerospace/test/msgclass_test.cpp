@@ -0,0 +1,37 @@
+/*
+ * Tests of Message ID classification
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include "test.hpp"
+#include "../src/msgclass.h"
+
+TEST(MsgClassTest, Table)
+{
+    for (int id = 0; id < 0xFFFF; id++)
+    {
+        const uint8_t cls = canasMessageClass(id);
+        if (id <= CANAS_MSGTYPE_EMERGENCY_EVENT_MAX)
+        {
+            EXPECT_EQ(CANAS_MSGCLASS_PARAM, cls);
+        }
+        else if (id <= CANAS_MSGTYPE_NODE_SERVICE_HIGH_MAX)
+        {
+            EXPECT_EQ(CANAS_SERVICE_CHANNEL_HIGH_MIN + (id - CANAS_MSGTYPE_NODE_SERVICE_HIGH_MIN) / 2, cls >> 1);
+            EXPECT_EQ(id & 1, cls & 1);
+        }
+        else if (id <= CANAS_MSGTYPE_DEBUG_SERVICE_MAX)
+        {
+            EXPECT_EQ(CANAS_MSGCLASS_PARAM, cls);
+        }
+        else if (id <= CANAS_MSGTYPE_NODE_SERVICE_LOW_MAX)
+        {
+            EXPECT_EQ(CANAS_SERVICE_CHANNEL_LOW_MIN + (id - CANAS_MSGTYPE_NODE_SERVICE_LOW_MIN) / 2, cls >> 1);
+            EXPECT_EQ(id & 1, cls & 1);
+        }
+        else
+        {
+            EXPECT_EQ(CANAS_MSGCLASS_WTF, cls);
+        }
+    }
+}
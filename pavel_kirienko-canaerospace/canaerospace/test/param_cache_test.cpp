@@ -0,0 +1,163 @@
+/*
+ * Tests of the parameter cache reads
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include <atomic>
+#include <thread>
+#include "test.hpp"
+
+namespace
+{
+    const uint16_t MSG_ID = 300;
+
+    /// Every field of the message is derived from the sequence number, so a torn read is easy to detect
+    CanasCanFrame makeSeqFrame(uint32_t seqnum, uint8_t redund_chan)
+    {
+        return makeFrame(MSG_ID, redund_chan, seqnum >> 24, CANAS_DATATYPE_ULONG, seqnum >> 16, seqnum,
+                         (seqnum >> 24) & 0xFF, (seqnum >> 16) & 0xFF, (seqnum >> 8) & 0xFF, seqnum & 0xFF);
+    }
+
+    bool isConsistent(const CanasParamCallbackArgs& args, uint64_t timestamp_step)
+    {
+        const uint32_t seqnum = args.message.data.container.ULONG;
+        return args.timestamp_usec == uint64_t(seqnum) * timestamp_step &&
+               args.message.node_id == uint8_t(seqnum >> 24) &&
+               args.message.service_code == uint8_t(seqnum >> 16) &&
+               args.message.message_code == uint8_t(seqnum);
+    }
+}
+
+TEST(ParamCacheTest, Copy)
+{
+    CanasConfig cfg = makeGenericConfig();
+    cfg.fn_hook = NULL;
+    CanasInstance inst;
+    ASSERT_EQ(0, canasInit(&inst, &cfg, NULL));
+    ASSERT_EQ(0, canasParamSubscribe(&inst, MSG_ID, 1, NULL, NULL));
+
+    const CanasCanFrame frm = makeSeqFrame(0x01020304, 0);
+    EXPECT_EQ(0, canasUpdateAt(&inst, 0, &frm, 0x01020304ull * 10));
+
+    CanasParamCallbackArgs args;
+    ASSERT_EQ(0, canasParamRead(&inst, MSG_ID, 0, &args));
+    EXPECT_TRUE(isConsistent(args, 10));
+
+    // Direct copy of an entry:
+    CanasParamCacheEntry src, dst;
+    std::memset(&src, 0, sizeof(src));
+    std::memset(&dst, 0xFF, sizeof(dst));
+    src.message = args.message;
+    src.timestamp_usec = args.timestamp_usec;
+    EXPECT_EQ(0, canasParamCacheCopy(&src, &dst));
+    EXPECT_EQ(0, std::memcmp(&src, &dst, sizeof(src)));
+}
+
+#if CANAEROSPACE_SEQLOCK
+
+/**
+ * The writer is stuck in the middle of an update, as if it was preempted by the reader.
+ */
+TEST(ParamCacheTest, Busy)
+{
+    CanasConfig cfg = makeGenericConfig();
+    CanasInstance inst;
+    ASSERT_EQ(0, canasInit(&inst, &cfg, NULL));
+    ASSERT_EQ(0, canasParamSubscribeRef(&inst, MSG_ID, 1, cbParamRef, NULL));
+
+    const CanasCanFrame frm = makeSeqFrame(1, 0);
+    EXPECT_EQ(0, canasUpdateAt(&inst, 0, &frm, 10));
+    CanasParamCacheEntry* pentry = const_cast<CanasParamCacheEntry*>(cbargs_param_ref.pentry);
+    ASSERT_TRUE(pentry != NULL);
+
+    pentry->seq++;
+    CanasParamCacheEntry copy;
+    EXPECT_EQ(-CANAS_ERR_BUSY, canasParamCacheCopy(pentry, &copy));
+    CanasParamCallbackArgs args;
+    EXPECT_EQ(-CANAS_ERR_BUSY, canasParamRead(&inst, MSG_ID, 0, &args));
+
+    pentry->seq++;
+    EXPECT_EQ(0, canasParamRead(&inst, MSG_ID, 0, &args));
+    EXPECT_TRUE(isConsistent(args, 10));
+}
+
+/**
+ * One thread updates the instance, the others read the same cache entries as fast as they can.
+ */
+TEST(ParamCacheTest, ConcurrentReaders)
+{
+    const int NUM_READERS = 3;
+    const uint32_t NUM_UPDATES = 300000;
+    const uint8_t REDUND_COUNT = 2;
+
+    CanasConfig cfg = makeGenericConfig();
+    cfg.fn_hook = NULL;
+    cfg.service_frame_hist_len = 0;
+    const uint64_t timestamp_step = cfg.repeat_timeout_usec + 1;    // Repetition detection must not interfere
+
+    CanasInstance inst;
+    ASSERT_EQ(0, canasInit(&inst, &cfg, NULL));
+    ASSERT_EQ(0, canasParamSubscribe(&inst, MSG_ID, REDUND_COUNT, NULL, NULL));
+
+    std::atomic<bool> done(false);
+    std::atomic<uint64_t> num_reads(0), num_torn(0), num_busy(0), num_errors(0);
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < NUM_READERS; i++)
+    {
+        readers.push_back(std::thread([&, i]()
+        {
+            uint64_t reads = 0, torn = 0, busy = 0, errors = 0;
+            uint32_t last_seqnum[REDUND_COUNT] = { 0, 0 };
+            while (!done.load(std::memory_order_relaxed))
+            {
+                const uint8_t chan = uint8_t((reads + i) % REDUND_COUNT);
+                CanasParamCallbackArgs args;
+                const int res = canasParamRead(&inst, MSG_ID, chan, &args);
+                if (res == -CANAS_ERR_BUSY)
+                {
+                    busy++;                                     // The writer was preempted, fine on a loaded host
+                    std::this_thread::yield();
+                    continue;
+                }
+                if (res != 0)
+                {
+                    errors++;
+                    continue;
+                }
+                reads++;
+                if (args.timestamp_usec == 0)
+                    continue;                                   // Nothing received yet
+                if (!isConsistent(args, timestamp_step))
+                    torn++;
+                if (args.message.data.container.ULONG < last_seqnum[chan])
+                    errors++;                                   // Values must never go back in time
+                last_seqnum[chan] = args.message.data.container.ULONG;
+            }
+            num_reads += reads;
+            num_torn += torn;
+            num_busy += busy;
+            num_errors += errors;
+        }));
+    }
+
+    for (uint32_t seqnum = 1; seqnum <= NUM_UPDATES; seqnum++)
+    {
+        const CanasCanFrame frm = makeSeqFrame(seqnum, seqnum % REDUND_COUNT);
+        ASSERT_EQ(0, canasUpdateAt(&inst, 0, &frm, seqnum * timestamp_step));
+    }
+    done = true;
+    for (size_t i = 0; i < readers.size(); i++)
+        readers[i].join();
+
+    std::cout << "ConcurrentReaders: " << std::dec << num_reads << " reads, " << num_busy << " busy" << std::endl;
+    EXPECT_LT(0u, num_reads.load());
+    EXPECT_EQ(0u, num_torn.load());
+    EXPECT_EQ(0u, num_errors.load());
+
+    CanasParamCallbackArgs args;
+    ASSERT_EQ(0, canasParamRead(&inst, MSG_ID, 0, &args));
+    EXPECT_EQ(NUM_UPDATES, args.message.data.container.ULONG);
+}
+
+#endif
@@ -0,0 +1,123 @@
+/*
+ * Tests of the parameter metadata registry
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include <string>
+#include <canaerospace/param_registry.h>
+#include <canaerospace/param_id/nod_default.h>
+#include <canaerospace/param_id/uav.h>
+#include "test.hpp"
+
+TEST(ParamRegistryTest, Find)
+{
+    const CanasParamRegistry* preg = &canas_param_registry_default;
+    ASSERT_LT(0, preg->num_entries);
+    for (int i = 1; i < preg->num_entries; i++)
+        ASSERT_LT(preg->pentries[i - 1].message_id, preg->pentries[i].message_id);
+
+    const CanasParamMeta* pmeta = canasParamMetaFind(preg, CANAS_NOD_DEF_BODY_PITCH_RATE);
+    ASSERT_TRUE(pmeta != NULL);
+    EXPECT_STREQ("BODY_PITCH_RATE", pmeta->name);
+    EXPECT_STREQ("deg/s", pmeta->units);
+    EXPECT_EQ(CANAS_PARAM_TYPE_BIT(CANAS_DATATYPE_FLOAT) | CANAS_PARAM_TYPE_BIT(CANAS_DATATYPE_SHORT2),
+              pmeta->type_mask);
+    EXPECT_TRUE(canasParamMetaTypeAllowed(pmeta, CANAS_DATATYPE_SHORT2));
+    EXPECT_FALSE(canasParamMetaTypeAllowed(pmeta, CANAS_DATATYPE_SHORT));
+    EXPECT_FALSE(canasParamMetaTypeAllowed(pmeta, CANAS_DATATYPE_UDEF_BEGIN_));
+
+    // First, last, and from both headers:
+    ASSERT_TRUE((pmeta = canasParamMetaFind(preg, CANAS_UAV_ESC_COMMAND_1)) != NULL);
+    EXPECT_EQ(CANAS_PARAM_TYPE_BIT(CANAS_DATATYPE_USHORT), pmeta->type_mask);
+    ASSERT_TRUE((pmeta = canasParamMetaFind(preg, CANAS_UAV_GRIPPER_GRIP_STATE)) != NULL);
+    EXPECT_STREQ("UAV_GRIPPER_GRIP_STATE", pmeta->name);
+    ASSERT_TRUE((pmeta = canasParamMetaFind(preg, CANAS_UAV_GIMBAL_PITCH_RATE)) != NULL);
+    EXPECT_STREQ("deg/s", pmeta->units);
+    ASSERT_TRUE((pmeta = canasParamMetaFind(preg, CANAS_NOD_DEF_GPS_AIRCRAFT_LATITUDE)) != NULL);
+    EXPECT_TRUE(canasParamMetaTypeAllowed(pmeta, CANAS_DATATYPE_DOUBLEL));
+    ASSERT_TRUE((pmeta = canasParamMetaFind(preg, CANAS_NOD_DEF_DATE)) != NULL);
+    EXPECT_STREQ("", pmeta->units);
+
+    EXPECT_EQ(NULL, canasParamMetaFind(preg, 1300));          // Skipped range
+    EXPECT_EQ(NULL, canasParamMetaFind(preg, 0));
+    EXPECT_EQ(NULL, canasParamMetaFind(NULL, CANAS_NOD_DEF_BODY_PITCH_RATE));
+}
+
+TEST(ParamRegistryTest, Dump)
+{
+    const CanasParamRegistry* preg = &canas_param_registry_default;
+    char buf[CANAS_DUMP_PARAM_BUF_LEN];
+    CanasMessageData msgd;
+    std::memset(&msgd, 0, sizeof(msgd));
+
+    msgd.type = CANAS_DATATYPE_FLOAT;
+    msgd.container.FLOAT = 2.5f;
+    EXPECT_EQ(std::string("303 BODY_PITCH_RATE = 2.5 deg/s"),
+              canasDumpParam(preg, CANAS_NOD_DEF_BODY_PITCH_RATE, &msgd, buf));
+
+    msgd.type = CANAS_DATATYPE_SHORT2;
+    msgd.container.SHORT2[0] = -12;
+    msgd.container.SHORT2[1] = 34;
+    EXPECT_EQ(std::string("303 BODY_PITCH_RATE = -12 34 deg/s"),
+              canasDumpParam(preg, CANAS_NOD_DEF_BODY_PITCH_RATE, &msgd, buf));
+
+    msgd.type = CANAS_DATATYPE_SHORT;
+    msgd.container.SHORT = -7;
+    EXPECT_EQ(std::string("303 BODY_PITCH_RATE = -7 (bad data type 6)"),
+              canasDumpParam(preg, CANAS_NOD_DEF_BODY_PITCH_RATE, &msgd, buf));
+    EXPECT_EQ(std::string("303 = -7"), canasDumpParam(NULL, CANAS_NOD_DEF_BODY_PITCH_RATE, &msgd, buf));
+
+    msgd.type = CANAS_DATATYPE_BLONG;
+    msgd.container.BLONG = 0xdeadbeef;
+    EXPECT_EQ(std::string("439 TRIM_SYSTEM_SWITCHES = 0xdeadbeef"),
+              canasDumpParam(preg, CANAS_NOD_DEF_TRIM_SYSTEM_SWITCHES, &msgd, buf));
+
+    msgd.type = CANAS_DATATYPE_ACHAR4;
+    std::memcpy(msgd.container.ACHAR4, "AB\x01Z", 4);
+    EXPECT_EQ(std::string("299 = 'AB.Z'"), canasDumpParam(preg, 299, &msgd, buf));
+
+    msgd.type = CANAS_DATATYPE_UDEF_BEGIN_;
+    msgd.length = 2;
+    EXPECT_EQ(std::string("1899 = udef100 41 42"), canasDumpParam(preg, 1899, &msgd, buf));
+
+    // Truncation:
+    msgd.type = CANAS_DATATYPE_UCHAR4;
+    const std::string longest = canasDumpParam(preg, CANAS_NOD_DEF_ENGINE_1_FUEL_FLOW_RATE_ECS_CHANNEL_A, &msgd, buf);
+    EXPECT_GT(int(sizeof(buf)), int(longest.length()));
+}
+
+TEST(ParamRegistryTest, Reception)
+{
+    CanasConfig cfg = makeGenericConfig();
+    cfg.pparam_registry = &canas_param_registry_default;
+    CanasInstance inst;
+    ASSERT_EQ(0, canasInit(&inst, &cfg, NULL));
+
+    EXPECT_EQ(0, canasParamSubscribe(&inst, CANAS_NOD_DEF_BODY_PITCH_RATE, 1, cbParam, NULL));
+    EXPECT_EQ(0, canasParamSubscribe(&inst, 1899, 1, cbParam, NULL));            // Not registered
+
+    // Allowed data types:
+    cbcnt_param = 0;
+    CanasCanFrame frm = makeFrame(CANAS_NOD_DEF_BODY_PITCH_RATE, 0, 90, CANAS_DATATYPE_FLOAT, 0, 1,
+                                  0x40, 0x20, 0x00, 0x00);
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm, 1000));
+    frm = makeFrame(CANAS_NOD_DEF_BODY_PITCH_RATE, 0, 90, CANAS_DATATYPE_SHORT2, 0, 2, 0x00, 0x01, 0x00, 0x02);
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm, 2000));
+    EXPECT_EQ(2, cbcnt_param);
+
+    // Type mismatch and user-defined type are dropped and reported, the cache is untouched:
+    frm = makeFrame(CANAS_NOD_DEF_BODY_PITCH_RATE, 0, 90, CANAS_DATATYPE_SHORT, 0, 3, 0x00, 0x01);
+    EXPECT_EQ(-CANAS_ERR_BAD_DATA_TYPE, _canasUpdateWithTimestamp(&inst, 0, &frm, 3000));
+    frm = makeFrame(CANAS_NOD_DEF_BODY_PITCH_RATE, 0, 90, CANAS_DATATYPE_UDEF_BEGIN_, 0, 4, 0x00, 0x01);
+    EXPECT_EQ(-CANAS_ERR_BAD_DATA_TYPE, _canasUpdateWithTimestamp(&inst, 0, &frm, 4000));
+    EXPECT_EQ(2, cbcnt_param);
+
+    CanasParamCallbackArgs args;
+    EXPECT_EQ(0, canasParamRead(&inst, CANAS_NOD_DEF_BODY_PITCH_RATE, 0, &args));
+    EXPECT_EQ(CANAS_DATATYPE_SHORT2, args.message.data.type);
+
+    // Unregistered parameters accept anything:
+    frm = makeFrame(1899, 0, 90, CANAS_DATATYPE_UDEF_BEGIN_, 0, 1, 0x00, 0x01);
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm, 5000));
+    EXPECT_EQ(3, cbcnt_param);
+}
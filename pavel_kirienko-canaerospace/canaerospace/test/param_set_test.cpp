@@ -0,0 +1,148 @@
+/*
+ * Tests of the generated parameter set, see test/demo_params.csv
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include "demo_params.hpp"
+#include "test.hpp"
+
+namespace
+{
+    int gimbal_roll_calls = 0;
+    uint8_t gimbal_roll_chan = 0;
+    float gimbal_roll_value = 0;
+
+    uint8_t battery_cells[4] = { 0, 0, 0, 0 };
+
+    static_assert(std::is_same<demo_params::GimbalRoll::ValueType, float>::value, "");
+    static_assert(demo_params::StatusText::type_id == CANAS_DATATYPE_ACHAR4, "");
+    static_assert(canaerospace::ParamBinding<CANAS_DEMO_PARAMS_ESC_COMMAND_1>::type_id == CANAS_DATATYPE_USHORT, "");
+}
+
+void onGimbalRoll(CanasInstance*, uint8_t redund_chan, float value)
+{
+    gimbal_roll_calls++;
+    gimbal_roll_chan = redund_chan;
+    gimbal_roll_value = value;
+}
+
+void onBatteryCells(CanasInstance*, uint8_t, const uint8_t value[4])
+{
+    std::memcpy(battery_cells, value, 4);
+}
+
+TEST(ParamSetTest, Metadata)
+{
+    const CanasParamMeta* pmeta = canasParamMetaFind(&canas_demo_params_registry, CANAS_DEMO_PARAMS_GIMBAL_ROLL);
+    ASSERT_TRUE(pmeta != NULL);
+    EXPECT_STREQ("GIMBAL_ROLL", pmeta->name);
+    EXPECT_STREQ("deg", pmeta->units);
+    EXPECT_EQ(50, pmeta->nominal_rate_hz);
+    EXPECT_EQ(CANAS_PARAM_TYPE_BIT(CANAS_DATATYPE_FLOAT), pmeta->type_mask);
+    EXPECT_EQ(6, canas_demo_params_registry.num_entries);
+
+    EXPECT_EQ(3, canas_demo_params_table.num_subscriptions);
+    EXPECT_EQ(3, canas_demo_params_table.num_advertisements);
+
+    // Nothing is loaded yet:
+    float value = 0;
+    EXPECT_EQ(-CANAS_ERR_NO_SUCH_ENTRY, canasDemoParamsReadGimbalRoll(0, &value, NULL));
+}
+
+TEST(ParamSetTest, Basic)
+{
+    resetMemory();
+    CanasConfig cfg = makeGenericConfig();
+    cfg.service_frame_hist_len = 0;
+    cfg.pstatic_table = &canas_demo_params_table;
+    cfg.pparam_registry = &canas_demo_params_registry;
+    CanasInstance inst;
+    ASSERT_EQ(0, canasInit(&inst, &cfg, NULL));
+    EXPECT_EQ(0, mem_chunks.size());
+
+    // Reception through the generated handler and accessor:
+    float value = 0;
+    uint64_t timestamp = 0;
+    EXPECT_EQ(-CANAS_ERR_BAD_DATA_TYPE, canasDemoParamsReadGimbalRoll(1, &value, &timestamp));
+
+    CanasCanFrame frm = makeFrame(CANAS_DEMO_PARAMS_GIMBAL_ROLL, 1, 90, CANAS_DATATYPE_FLOAT, 0, 1,
+                                  0x40, 0x20, 0x00, 0x00);   // 2.5f
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm, 1000));
+    EXPECT_EQ(1, gimbal_roll_calls);
+    EXPECT_EQ(1, gimbal_roll_chan);
+    EXPECT_FLOAT_EQ(2.5f, gimbal_roll_value);
+
+    EXPECT_EQ(0, canasDemoParamsReadGimbalRoll(1, &value, &timestamp));
+    EXPECT_FLOAT_EQ(2.5f, value);
+    EXPECT_EQ(1000, timestamp);
+    EXPECT_EQ(-CANAS_ERR_BAD_REDUND_CHAN, canasDemoParamsReadGimbalRoll(2, &value, NULL));
+
+    // Wrong data type is rejected by the registry:
+    frm = makeFrame(CANAS_DEMO_PARAMS_GIMBAL_ROLL, 1, 90, CANAS_DATATYPE_SHORT, 0, 2, 0x00, 0x01);
+    EXPECT_EQ(-CANAS_ERR_BAD_DATA_TYPE, _canasUpdateWithTimestamp(&inst, 0, &frm, 2000));
+    EXPECT_EQ(1, gimbal_roll_calls);
+
+    // Subscription without handler:
+    frm = makeFrame(CANAS_DEMO_PARAMS_GIMBAL_ROLL_RATE, 2, 90, CANAS_DATATYPE_FLOAT, 0, 1, 0x3f, 0x80, 0x00, 0x00);
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm, 3000));
+    EXPECT_EQ(0, canasDemoParamsReadGimbalRollRate(2, &value, NULL));
+    EXPECT_FLOAT_EQ(1.0f, value);
+
+    // Array type:
+    frm = makeFrame(CANAS_DEMO_PARAMS_BATTERY_CELLS, 0, 90, CANAS_DATATYPE_UCHAR4, 0, 1, 41, 42, 43, 44);
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm, 4000));
+    EXPECT_EQ(44, battery_cells[3]);
+    uint8_t cells[4] = { 0, 0, 0, 0 };
+    EXPECT_EQ(0, canasDemoParamsReadBatteryCells(0, cells, NULL));
+    EXPECT_EQ(41, cells[0]);
+
+    // Publication:
+    std::fill(iface_send_return_values, iface_send_return_values + IFACE_COUNT, 1);
+    EXPECT_EQ(0, canasDemoParamsPublishEscCommand2(&inst, 0x1234));
+    EXPECT_EQ(CANAS_DEMO_PARAMS_ESC_COMMAND_2, int(iface_send_dump[0].id));
+    EXPECT_EQ(CANAS_DATATYPE_USHORT, iface_send_dump[0].data[1]);
+    EXPECT_EQ(0x12, iface_send_dump[0].data[4]);
+    EXPECT_EQ(0x34, iface_send_dump[0].data[5]);
+
+    const uint8_t text[4] = { 'O', 'K', '!', ' ' };
+    EXPECT_EQ(0, canasDemoParamsPublishStatusText(&inst, text));
+    EXPECT_EQ(CANAS_DEMO_PARAMS_STATUS_TEXT, int(iface_send_dump[0].id));
+    EXPECT_EQ('K', iface_send_dump[0].data[5]);
+
+    // The C++ typedefs refer to the same parameters:
+    EXPECT_EQ(0, demo_params::GimbalRoll::read(&inst, 1, value));
+    EXPECT_FLOAT_EQ(2.5f, value);
+    EXPECT_EQ(0, demo_params::EscCommand1::publish(&inst, 7));
+    EXPECT_EQ(CANAS_DEMO_PARAMS_ESC_COMMAND_1, int(iface_send_dump[0].id));
+    EXPECT_EQ(0, mem_chunks.size());
+}
+
+TEST(ParamSetTest, Removal)
+{
+    CanasConfig cfg = makeGenericConfig();
+    cfg.pstatic_table = &canas_demo_params_table;
+    cfg.pparam_registry = &canas_demo_params_registry;
+    CanasInstance inst;
+    ASSERT_EQ(0, canasInit(&inst, &cfg, NULL));
+
+    // The accessors address the static storage directly, so they must see that the entries are gone:
+    std::fill(iface_send_return_values, iface_send_return_values + IFACE_COUNT, 1);
+    EXPECT_EQ(0, canasDemoParamsPublishEscCommand2(&inst, 1));
+    EXPECT_EQ(0, canasParamUnadvertise(&inst, CANAS_DEMO_PARAMS_ESC_COMMAND_2));
+    EXPECT_EQ(-CANAS_ERR_NO_SUCH_ENTRY, canasDemoParamsPublishEscCommand2(&inst, 1));
+    EXPECT_EQ(0, canasDemoParamsPublishEscCommand1(&inst, 1));
+
+    float value = 0;
+    const CanasCanFrame frm = makeFrame(CANAS_DEMO_PARAMS_GIMBAL_ROLL_RATE, 0, 90, CANAS_DATATYPE_FLOAT, 0, 1,
+                                        0x3f, 0x80, 0x00, 0x00);
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm, 1000));
+    EXPECT_EQ(0, canasDemoParamsReadGimbalRollRate(0, &value, NULL));
+    EXPECT_EQ(0, canasParamUnsubscribe(&inst, CANAS_DEMO_PARAMS_GIMBAL_ROLL_RATE));
+    EXPECT_EQ(-CANAS_ERR_NO_SUCH_ENTRY, canasDemoParamsReadGimbalRollRate(0, &value, NULL));
+    EXPECT_EQ(-CANAS_ERR_NO_SUCH_ENTRY, canasParamUnsubscribe(&inst, CANAS_DEMO_PARAMS_GIMBAL_ROLL_RATE));
+
+    // The next load restores them:
+    ASSERT_EQ(0, canasInit(&inst, &cfg, NULL));
+    EXPECT_EQ(0, canasDemoParamsPublishEscCommand2(&inst, 1));
+    EXPECT_EQ(-CANAS_ERR_BAD_DATA_TYPE, canasDemoParamsReadGimbalRollRate(0, &value, NULL));
+}
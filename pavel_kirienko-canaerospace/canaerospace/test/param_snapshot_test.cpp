@@ -0,0 +1,192 @@
+/*
+ * Tests of the parameter snapshots
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include <atomic>
+#include <thread>
+#include "test.hpp"
+
+TEST(ParamSnapshotTest, Basic)
+{
+    CanasConfig cfg = makeGenericConfig();
+    CanasInstance inst;
+    ASSERT_EQ(0, canasInit(&inst, &cfg, NULL));
+    ASSERT_EQ(0, canasParamSubscribe(&inst, 300, 2, NULL, NULL));
+    ASSERT_EQ(0, canasParamSubscribe(&inst, 301, 1, cbParam, NULL));
+
+    const CanasParamSnapshotItem items[] = { { 301, 0 }, { 300, 1 }, { 300, 0 } };
+    const CanasParamCacheEntry* entries[3];
+    CanasParamSnapshot snap;
+
+    // Bad items:
+    const CanasParamSnapshotItem bad_chan[] = { { 300, 2 } };
+    const CanasParamSnapshotItem bad_id[] = { { 300, 0 }, { 302, 0 } };
+    EXPECT_EQ(-CANAS_ERR_BAD_REDUND_CHAN, canasParamSnapshotInit(&inst, &snap, bad_chan, 1, entries));
+    EXPECT_EQ(-CANAS_ERR_NO_SUCH_ENTRY, canasParamSnapshotInit(&inst, &snap, bad_id, 2, entries));
+    EXPECT_EQ(-CANAS_ERR_ARGUMENT, canasParamSnapshotInit(&inst, &snap, items, 3, NULL));
+    EXPECT_EQ(-CANAS_ERR_ARGUMENT, canasParamSnapshotInit(&inst, &snap, items, -1, entries));
+
+    ASSERT_EQ(0, canasParamSnapshotInit(&inst, &snap, items, 3, entries));
+    EXPECT_EQ(3, snap.num_items);
+
+    CanasMessageData values[3];
+    uint64_t timestamps[3];
+    uint8_t msgcodes[3];
+    uint8_t fresh[3];
+    CanasParamSnapshotData data;
+    data.pvalues = values;
+    data.ptimestamps_usec = timestamps;
+    data.pmessage_codes = msgcodes;
+    data.pfresh = fresh;
+
+    // Nothing is received yet:
+    EXPECT_EQ(0, canasParamSnapshotTake(&snap, 1000, 0, &data));
+    EXPECT_EQ(0, timestamps[0]);
+    EXPECT_EQ(0, fresh[1]);
+
+    CanasCanFrame frm = makeFrame(300, 1, 90, CANAS_DATATYPE_USHORT, 0, 7, 0x12, 0x34);
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm, 1000));
+    frm = makeFrame(301, 0, 90, CANAS_DATATYPE_FLOAT, 0, 9, 0x40, 0x20, 0x00, 0x00);
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm, 5000));
+
+    EXPECT_EQ(2, canasParamSnapshotTake(&snap, 6000, 0, &data));
+    EXPECT_EQ(CANAS_DATATYPE_FLOAT, values[0].type);
+    EXPECT_FLOAT_EQ(2.5f, values[0].container.FLOAT);
+    EXPECT_EQ(5000, timestamps[0]);
+    EXPECT_EQ(9, msgcodes[0]);
+    EXPECT_EQ(0x1234, values[1].container.USHORT);
+    EXPECT_EQ(1000, timestamps[1]);
+    EXPECT_EQ(7, msgcodes[1]);
+    EXPECT_EQ(1, fresh[0]);
+    EXPECT_EQ(1, fresh[1]);
+    EXPECT_EQ(0, fresh[2]);
+
+    // Freshness:
+    EXPECT_EQ(1, canasParamSnapshotTake(&snap, 6000, 1000, &data));
+    EXPECT_EQ(1, fresh[0]);
+    EXPECT_EQ(0, fresh[1]);
+    EXPECT_EQ(2, canasParamSnapshotTake(&snap, 1000, 1, &data));   // The entry is newer than the current time
+
+    // Only some of the arrays:
+    std::fill(timestamps, timestamps + 3, 0);
+    data.pvalues = NULL;
+    data.pfresh = NULL;
+    EXPECT_EQ(2, canasParamSnapshotTake(&snap, 6000, 0, &data));
+    EXPECT_EQ(5000, timestamps[0]);
+
+    // Empty snapshot:
+    ASSERT_EQ(0, canasParamSnapshotInit(&inst, &snap, NULL, 0, NULL));
+    EXPECT_EQ(0, canasParamSnapshotTake(&snap, 6000, 0, &data));
+    EXPECT_EQ(-CANAS_ERR_ARGUMENT, canasParamSnapshotTake(&snap, 6000, 0, NULL));
+}
+
+#if CANAEROSPACE_SEQLOCK
+
+/**
+ * Only the entries of the snapshot matter; the writer is stuck in the middle of an update, as if it was preempted.
+ */
+TEST(ParamSnapshotTest, Busy)
+{
+    CanasConfig cfg = makeGenericConfig();
+    CanasInstance inst;
+    ASSERT_EQ(0, canasInit(&inst, &cfg, NULL));
+    ASSERT_EQ(0, canasParamSubscribe(&inst, 300, 1, NULL, NULL));
+    ASSERT_EQ(0, canasParamSubscribe(&inst, 301, 1, NULL, NULL));
+
+    const CanasParamSnapshotItem items[] = { { 300, 0 } };
+    const CanasParamSnapshotItem other_items[] = { { 301, 0 } };
+    const CanasParamCacheEntry* entries[1];
+    const CanasParamCacheEntry* other_entries[1];
+    CanasParamSnapshot snap, other_snap;
+    ASSERT_EQ(0, canasParamSnapshotInit(&inst, &snap, items, 1, entries));
+    ASSERT_EQ(0, canasParamSnapshotInit(&inst, &other_snap, other_items, 1, other_entries));
+
+    CanasParamSnapshotData data;
+    std::memset(&data, 0, sizeof(data));
+
+    CanasParamCacheEntry* pother = const_cast<CanasParamCacheEntry*>(other_entries[0]);
+    pother->seq++;
+    EXPECT_EQ(0, canasParamSnapshotTake(&snap, 0, 0, &data));
+    EXPECT_EQ(-CANAS_ERR_BUSY, canasParamSnapshotTake(&other_snap, 0, 0, &data));
+    pother->seq++;
+
+    CanasParamCacheEntry* pentry = const_cast<CanasParamCacheEntry*>(entries[0]);
+    pentry->seq++;
+    EXPECT_EQ(-CANAS_ERR_BUSY, canasParamSnapshotTake(&snap, 0, 0, &data));
+    pentry->seq++;
+    EXPECT_EQ(0, canasParamSnapshotTake(&snap, 0, 0, &data));
+}
+
+/**
+ * The writer updates A then B with the same value, so any consistent state has B <= A <= B + 1.
+ * Per-entry consistency alone would allow a snapshot where A is stale and B is not.
+ */
+TEST(ParamSnapshotTest, ConcurrentSnapshots)
+{
+    const uint32_t NUM_UPDATES = 200000;
+    const uint16_t MSG_A = 300, MSG_B = 301;
+
+    CanasConfig cfg = makeGenericConfig();
+    cfg.fn_hook = NULL;
+    cfg.service_frame_hist_len = 0;
+    const uint64_t timestamp_step = cfg.repeat_timeout_usec + 1;
+
+    CanasInstance inst;
+    ASSERT_EQ(0, canasInit(&inst, &cfg, NULL));
+    ASSERT_EQ(0, canasParamSubscribe(&inst, MSG_A, 1, NULL, NULL));
+    ASSERT_EQ(0, canasParamSubscribe(&inst, MSG_B, 1, NULL, NULL));
+
+    const CanasParamSnapshotItem items[] = { { MSG_A, 0 }, { MSG_B, 0 } };
+    const CanasParamCacheEntry* entries[2];
+    CanasParamSnapshot snap;
+    ASSERT_EQ(0, canasParamSnapshotInit(&inst, &snap, items, 2, entries));
+
+    std::atomic<bool> done(false);
+    std::atomic<uint64_t> num_snapshots(0), num_busy(0), num_inconsistent(0);
+
+    std::thread reader([&]()
+    {
+        uint64_t snapshots = 0, busy = 0, inconsistent = 0;
+        while (!done.load(std::memory_order_relaxed))
+        {
+            CanasMessageData values[2];
+            CanasParamSnapshotData data;
+            std::memset(&data, 0, sizeof(data));
+            data.pvalues = values;
+            if (canasParamSnapshotTake(&snap, 0, 0, &data) == -CANAS_ERR_BUSY)
+            {
+                busy++;                                         // The writer was preempted, fine on a loaded host
+                std::this_thread::yield();
+                continue;
+            }
+            const uint32_t a = values[0].container.ULONG, b = values[1].container.ULONG;
+            if (a < b || a > b + 1)
+                inconsistent++;
+            snapshots++;
+        }
+        num_snapshots += snapshots;
+        num_busy += busy;
+        num_inconsistent += inconsistent;
+    });
+
+    for (uint32_t i = 1; i <= NUM_UPDATES; i++)
+    {
+        const uint64_t ts = i * timestamp_step;
+        const CanasCanFrame frm_a = makeFrame(MSG_A, 0, 90, CANAS_DATATYPE_ULONG, 0, i,
+                                              i >> 24, (i >> 16) & 0xFF, (i >> 8) & 0xFF, i & 0xFF);
+        ASSERT_EQ(0, canasUpdateAt(&inst, 0, &frm_a, ts));
+        const CanasCanFrame frm_b = makeFrame(MSG_B, 0, 90, CANAS_DATATYPE_ULONG, 0, i,
+                                              i >> 24, (i >> 16) & 0xFF, (i >> 8) & 0xFF, i & 0xFF);
+        ASSERT_EQ(0, canasUpdateAt(&inst, 0, &frm_b, ts));
+    }
+    done = true;
+    reader.join();
+
+    std::cout << "ConcurrentSnapshots: " << std::dec << num_snapshots << " snapshots, " << num_busy << " busy"
+              << std::endl;
+    EXPECT_LT(0u, num_snapshots.load());
+    EXPECT_EQ(0u, num_inconsistent.load());
+}
+
+#endif
@@ -0,0 +1,135 @@
+/*
+ * Tests of the pool allocator
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include <vector>
+#include <canaerospace/pool.h>
+#include "test.hpp"
+
+TEST(PoolTest, Basic)
+{
+    static uint8_t buf[1024 + 1];
+    CanasPool pool;
+    EXPECT_EQ(-CANAS_ERR_ARGUMENT, canasPoolInit(&pool, NULL, sizeof(buf)));
+    EXPECT_EQ(0, canasPoolInit(&pool, buf + 1, 1024));       // Misaligned on purpose
+    EXPECT_EQ(1024 - CANAS_POOL_ALIGNMENT + 1, int(pool.buf_size));
+
+    EXPECT_TRUE(canasPoolAlloc(&pool, 0) == NULL);
+    EXPECT_TRUE(canasPoolAlloc(&pool, 8192) == NULL);        // Larger than the largest class
+    EXPECT_EQ(1, int(pool.failures));
+
+    // Sizes are rounded up to the nearest class, including the header:
+    uint8_t* a = static_cast<uint8_t*>(canasPoolAlloc(&pool, 8));      // 16
+    uint8_t* b = static_cast<uint8_t*>(canasPoolAlloc(&pool, 9));      // 24
+    uint8_t* c = static_cast<uint8_t*>(canasPoolAlloc(&pool, 100));    // 128
+    ASSERT_TRUE(a && b && c);
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(a) % CANAS_POOL_ALIGNMENT);
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(b) % CANAS_POOL_ALIGNMENT);
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(c) % CANAS_POOL_ALIGNMENT);
+    EXPECT_EQ(16 + 24 + 128, int(pool.buf_used));
+    EXPECT_EQ(16 + 24 + 128, int(pool.bytes_in_use));
+    std::memset(a, 0xAA, 8);
+    std::memset(b, 0xBB, 9);
+    std::memset(c, 0xCC, 100);
+
+    // Freed block is reused by the same class only:
+    canasPoolFree(&pool, b);
+    canasPoolFree(&pool, b);                                 // Double free is ignored
+    EXPECT_EQ(16 + 128, int(pool.bytes_in_use));
+    EXPECT_TRUE(canasPoolAlloc(&pool, 16) == b);
+    EXPECT_EQ(16 + 24 + 128, int(pool.buf_used));
+    uint8_t* d = static_cast<uint8_t*>(canasPoolAlloc(&pool, 16));
+    EXPECT_TRUE(d > c);
+    EXPECT_EQ(16 + 24 + 128 + 24, int(pool.buf_used));
+    EXPECT_EQ(0xAA, a[7]);
+    EXPECT_EQ(0xCC, c[99]);
+
+    canasPoolFree(&pool, NULL);
+    canasPoolFree(&pool, a);
+    canasPoolFree(&pool, b);
+    canasPoolFree(&pool, c);
+    canasPoolFree(&pool, d);
+    EXPECT_EQ(0, int(pool.bytes_in_use));
+    EXPECT_EQ(16 + 24 + 128 + 24, int(pool.bytes_peak));
+    for (int i = 0; i < CANAS_POOL_CLASS_COUNT; i++)
+        EXPECT_EQ(0, int(pool.classes[i].blocks_in_use));
+    EXPECT_EQ(2, int(pool.classes[1].blocks_peak));
+    EXPECT_EQ(2, int(pool.classes[1].blocks_total));
+
+    // Exhaustion:
+    int count = 0;
+    while (canasPoolAlloc(&pool, 100) != NULL)
+        count++;
+    EXPECT_LT(0, count);
+    EXPECT_LT(pool.buf_size - pool.buf_used, 128u);
+    EXPECT_EQ(2, int(pool.failures));
+}
+
+TEST(PoolTest, Churn)
+{
+    static uint8_t buf[64 * 1024];
+    CanasPool pool;
+    EXPECT_EQ(0, canasPoolInit(&pool, buf, sizeof(buf)));
+
+    // Random allocations and deallocations of random sizes must not grow the pool beyond the peak usage
+    std::srand(42);
+    std::vector<std::pair<uint8_t*, int> > blocks;
+    uint32_t buf_used = 0;
+    for (int i = 0; i < 100000; i++)
+    {
+        if (blocks.size() < 50 && (std::rand() % 2 || blocks.empty()))
+        {
+            const int size = 1 + std::rand() % 600;
+            uint8_t* p = static_cast<uint8_t*>(canasPoolAlloc(&pool, size));
+            ASSERT_TRUE(p != NULL);
+            std::memset(p, size & 0xFF, size);
+            blocks.push_back(std::make_pair(p, size));
+        }
+        else
+        {
+            const int index = std::rand() % blocks.size();
+            for (int k = 0; k < blocks[index].second; k++)
+                ASSERT_EQ(blocks[index].second & 0xFF, blocks[index].first[k]) << "Memory corrupted";
+            canasPoolFree(&pool, blocks[index].first);
+            blocks.erase(blocks.begin() + index);
+        }
+        if (i == 50000)
+            buf_used = pool.buf_used;
+    }
+    EXPECT_EQ(0, int(pool.failures));
+    EXPECT_LT(pool.buf_used, buf_used * 2) << "The pool keeps growing";
+    for (size_t i = 0; i < blocks.size(); i++)
+        canasPoolFree(&pool, blocks[i].first);
+    EXPECT_EQ(0, int(pool.bytes_in_use));
+}
+
+TEST(PoolTest, Instance)
+{
+    static uint8_t buf[4096];
+    CanasPool pool;
+    EXPECT_EQ(0, canasPoolInit(&pool, buf, sizeof(buf)));
+
+    CanasConfig cfg = makeGenericConfig();
+    cfg.fn_malloc = canasPoolMallocFn;
+    cfg.fn_free = canasPoolFreeFn;
+    cfg.pmem_state = &pool;
+    CanasInstance inst;
+    EXPECT_EQ(0, canasInit(&inst, &cfg, NULL));
+    const uint32_t bytes_after_init = pool.bytes_in_use;     // Service history
+    EXPECT_LT(0u, bytes_after_init);
+
+    // Resubscription does not consume more memory
+    for (int i = 0; i < 100; i++)
+    {
+        EXPECT_EQ(0, canasParamSubscribe(&inst, 1000, 4, cbParam, NULL));
+        EXPECT_EQ(0, canasParamAdvertise(&inst, 1001, false));
+        EXPECT_EQ(0, canasServiceRegister(&inst, 8, cbSrvPoll, cbSrvRequest, cbSrvResponse, NULL));
+        EXPECT_EQ(0, canasServiceUnregister(&inst, 8));
+        EXPECT_EQ(0, canasParamUnadvertise(&inst, 1001));
+        EXPECT_EQ(0, canasParamUnsubscribe(&inst, 1000));
+        EXPECT_EQ(bytes_after_init, pool.bytes_in_use);
+    }
+    EXPECT_EQ(pool.bytes_peak, pool.buf_used);
+    EXPECT_EQ(0, int(pool.failures));
+}
@@ -90,6 +90,9 @@ TEST(StdSrvIDS, RequestUnicast)
         EXPECT_EQ(0, std::memcmp(iface_send_dump + i, &frm_expected_request, sizeof(CanasCanFrame)));
     }
 
+    // The library must wake up right after the request times out:
+    EXPECT_EQ(current_timestamp + inst.config.service_request_timeout_usec, canasGetNextDeadline(&inst));
+
     // Make sure that the outgoing request will fail in case if there is no free response slots:
     EXPECT_EQ(-CANAS_ERR_QUOTA_EXCEEDED, canasSrvIdsRequest(&inst, target_node_id, _doneCallback));
     // Note that the request above may produce spurious sendings, or may not, it is fully implementation dependent.
@@ -103,6 +106,7 @@ TEST(StdSrvIDS, RequestUnicast)
     EXPECT_EQ(0, canasUpdate(&inst, 0, &frm_response));
 
     // Check is received data correct:
+    EXPECT_EQ(CANAS_DEADLINE_NONE, canasGetNextDeadline(&inst));
     EXPECT_EQ(1, done_callback_calls);
     EXPECT_EQ(target_node_id, done_last_node_id);
     EXPECT_TRUE(0 == std::memcmp(&done_last_payload, &payld, sizeof(payld)));
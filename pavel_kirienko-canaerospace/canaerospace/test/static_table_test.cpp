@@ -0,0 +1,133 @@
+/*
+ * Tests of the static subscription and advertisement tables
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include <canaerospace/static_table.h>
+#include <canaerospace/param_id/nod_default.h>
+#include <canaerospace/param_id/uav.h>
+#include "test.hpp"
+
+namespace
+{
+#define TEST_SUBSCRIPTIONS(SUB) \
+    SUB(CANAS_NOD_DEF_BODY_PITCH_RATE, 2, cbParam, NULL) \
+    SUB(CANAS_NOD_DEF_BODY_ROLL_RATE,  1, cbParam, NULL) \
+    SUB(CANAS_UAV_ESC_COMMAND_1,       3, cbParam, NULL)
+#define TEST_ADVERTISEMENTS(ADV) \
+    ADV(CANAS_NOD_DEF_BODY_YAW_RATE, false) \
+    ADV(CANAS_UAV_ESC_COMMAND_2,     true)
+
+    CANAS_STATIC_TABLE(test_table, TEST_SUBSCRIPTIONS, TEST_ADVERTISEMENTS)
+
+    CANAS_STATIC_TABLE(empty_table, CANAS_STATIC_NONE, CANAS_STATIC_NONE)
+
+    constexpr CanasStaticSubscription cpp_subs[] =
+    {
+        { CANAS_UAV_ESC_COMMAND_1, 1, NULL, cbParamRef, NULL },
+        { CANAS_UAV_ESC_COMMAND_2, 4, NULL, cbParamRef, NULL }
+    };
+    uint64_t cpp_sub_storage[canasStaticStorageWords(cpp_subs)];
+    static_assert(sizeof(cpp_sub_storage) == CANAS_PARAM_SUBSCRIPTION_SIZE(1) + CANAS_PARAM_SUBSCRIPTION_SIZE(4),
+                  "Storage size");
+
+    CanasInstance makeStaticInstance(const CanasStaticTable* ptable)
+    {
+        CanasConfig cfg = makeGenericConfig();
+        cfg.service_frame_hist_len = 0;
+        cfg.pstatic_table = ptable;
+        CanasInstance inst;
+        EXPECT_EQ(0, canasInit(&inst, &cfg, NULL));
+        return inst;
+    }
+}
+
+TEST(StaticTableTest, Macros)
+{
+    EXPECT_EQ(3, test_table.num_subscriptions);
+    EXPECT_EQ(2, test_table.num_advertisements);
+    EXPECT_EQ(CANAS_PARAM_SUBSCRIPTION_SIZE(2) + CANAS_PARAM_SUBSCRIPTION_SIZE(1) + CANAS_PARAM_SUBSCRIPTION_SIZE(3),
+              sizeof(test_table_sub_storage_) - 8);
+    EXPECT_EQ(0, empty_table.num_subscriptions);
+    EXPECT_EQ(0, empty_table.num_advertisements);
+
+    resetMemory();
+    CanasInstance inst = makeStaticInstance(&empty_table);
+    EXPECT_EQ(0, mem_chunks.size());
+    CanasParamCallbackArgs args;
+    EXPECT_EQ(-CANAS_ERR_NO_SUCH_ENTRY, canasParamRead(&inst, CANAS_UAV_ESC_COMMAND_1, 0, &args));
+}
+
+TEST(StaticTableTest, Basic)
+{
+    resetMemory();
+    CanasInstance inst = makeStaticInstance(&test_table);
+    EXPECT_EQ(0, mem_chunks.size());                         // Startup does not allocate anything
+
+    // Reception:
+    cbcnt_param = 0;
+    CanasCanFrame frm = makeFrame(CANAS_UAV_ESC_COMMAND_1, 2, 90, CANAS_DATATYPE_USHORT, 0, 1, 0x12, 0x34);
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm, 1000));
+    EXPECT_EQ(1, cbcnt_param);
+    EXPECT_EQ(CANAS_UAV_ESC_COMMAND_1, cbargs_param.message_id);
+    EXPECT_EQ(2, cbargs_param.redund_channel_id);
+
+    CanasParamCallbackArgs args;
+    EXPECT_EQ(0, canasParamRead(&inst, CANAS_UAV_ESC_COMMAND_1, 2, &args));
+    EXPECT_EQ(0x1234, args.message.data.container.USHORT);
+    EXPECT_EQ(-CANAS_ERR_BAD_REDUND_CHAN, canasParamRead(&inst, CANAS_NOD_DEF_BODY_ROLL_RATE, 1, &args));
+
+    // Publication:
+    std::fill(iface_send_return_values, iface_send_return_values + IFACE_COUNT, 1);
+    CanasMessageData msgd;
+    msgd.type = CANAS_DATATYPE_FLOAT;
+    msgd.container.FLOAT = 1.0f;
+    EXPECT_EQ(0, canasParamPublish(&inst, CANAS_NOD_DEF_BODY_YAW_RATE, &msgd, 0));
+    EXPECT_EQ(-CANAS_ERR_NO_SUCH_ENTRY, canasParamPublish(&inst, CANAS_NOD_DEF_BODY_PITCH_RATE, &msgd, 0));
+    EXPECT_EQ(-CANAS_ERR_ENTRY_EXISTS, canasParamAdvertise(&inst, CANAS_UAV_ESC_COMMAND_2, false));
+
+    // Static entries can be removed, but they are never freed:
+    EXPECT_EQ(0, canasParamUnsubscribe(&inst, CANAS_NOD_DEF_BODY_ROLL_RATE));
+    EXPECT_EQ(0, canasParamUnadvertise(&inst, CANAS_UAV_ESC_COMMAND_2));
+    EXPECT_EQ(0, canasParamSubscribe(&inst, CANAS_NOD_DEF_BODY_ROLL_RATE, 2, cbParam, NULL));
+    EXPECT_EQ(1, mem_chunks.size());
+    EXPECT_EQ(0, canasParamUnsubscribe(&inst, CANAS_NOD_DEF_BODY_ROLL_RATE));
+    EXPECT_EQ(0, mem_chunks.size());
+}
+
+TEST(StaticTableTest, Cpp)
+{
+    CanasStaticTable table;
+    std::memset(&table, 0, sizeof(table));
+    table.psubscriptions = cpp_subs;
+    table.psubscription_storage = cpp_sub_storage;
+    table.num_subscriptions = sizeof(cpp_subs) / sizeof(cpp_subs[0]);
+
+    CanasInstance inst = makeStaticInstance(&table);
+    cbcnt_param_ref = 0;
+    CanasCanFrame frm = makeFrame(CANAS_UAV_ESC_COMMAND_2, 3, 90, CANAS_DATATYPE_USHORT, 0, 1, 0x12, 0x34);
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, 0, &frm, 1000));
+    EXPECT_EQ(1, cbcnt_param_ref);
+
+    // Invalid tables are rejected, and the preallocated memory is released:
+    resetMemory();
+    CanasConfig cfg = makeGenericConfig();
+    cfg.pstatic_table = &table;
+    cfg.max_param_subscriptions = 2;
+    table.psubscription_storage = NULL;
+    EXPECT_EQ(-CANAS_ERR_ARGUMENT, canasInit(&inst, &cfg, NULL));
+    EXPECT_EQ(0, mem_chunks.size());
+
+    const CanasStaticSubscription bad_subs[] = { { 3000, 1, cbParam, NULL, NULL } };
+    table.psubscriptions = bad_subs;
+    table.psubscription_storage = cpp_sub_storage;
+    table.num_subscriptions = 1;
+    EXPECT_EQ(-CANAS_ERR_BAD_MESSAGE_ID, canasInit(&inst, &cfg, NULL));
+    EXPECT_EQ(0, mem_chunks.size());
+
+    const CanasStaticSubscription dup_subs[] = { cpp_subs[0], cpp_subs[0] };
+    table.psubscriptions = dup_subs;
+    table.num_subscriptions = 2;
+    EXPECT_EQ(-CANAS_ERR_ENTRY_EXISTS, canasInit(&inst, &cfg, NULL));
+    EXPECT_EQ(0, mem_chunks.size());
+}
@@ -95,6 +95,22 @@ namespace
         return iface_send_return_values[iface];
     }
 
+    int iface_send_many_return_values[IFACE_COUNT];     // Zero means all frames were sent
+    int iface_send_many_counter[IFACE_COUNT];           // Number of calls, not frames
+    std::vector<CanasCanFrame> iface_send_many_dump[IFACE_COUNT];
+
+    int drvSendMany(CanasInstance* pi, int iface, const CanasCanFrame* pframes, int nframes)
+    {
+        CHECKPTR(pi);
+        CHECKPTR(pframes);
+        EXPECT_GT(nframes, 0);
+        EXPECT_GE(iface, 0);
+        EXPECT_LE(iface, IFACE_COUNT);
+        iface_send_many_counter[iface]++;
+        iface_send_many_dump[iface].insert(iface_send_many_dump[iface].end(), pframes, pframes + nframes);
+        return iface_send_many_return_values[iface] ? iface_send_many_return_values[iface] : nframes;
+    }
+
     int drvFilter(CanasInstance* pi, int iface, const CanasCanFilterConfig* pfilters, int nfilters)
     {
         CHECKPTR(pi);
@@ -144,6 +160,14 @@ namespace
         cbcnt_srv_poll++;
     }
 
+    /// State must point to the deadline to report
+    uint64_t cbSrvDeadline(CanasInstance* pi, void* pstate)
+    {
+        CHECKPTR(pi);
+        CHECKPTR(pstate);
+        return *static_cast<uint64_t*>(pstate);
+    }
+
     void cbSrvRequest(CanasInstance* pi, CanasServiceRequestCallbackArgs* pargs)
     {
         CHECKPTR(pi);
@@ -160,6 +184,64 @@ namespace
         cbcnt_srv_response++;
     }
 
+    /*
+     * Zero-copy callbacks; the pointed data is only valid within the callback, so it is copied here
+     */
+    CanasHookCallbackRefArgs cbargs_hook_ref;
+    CanasParamCallbackRefArgs cbargs_param_ref;
+    CanasServiceRequestCallbackRefArgs cbargs_srv_request_ref;
+    CanasServiceResponseCallbackRefArgs cbargs_srv_response_ref;
+
+    CanasMessage cbmsg_hook_ref;
+    CanasParamCacheEntry cbentry_param_ref;
+    CanasMessage cbmsg_srv_request_ref;
+    CanasMessage cbmsg_srv_response_ref;
+
+    int cbcnt_hook_ref = 0;
+    int cbcnt_param_ref = 0;
+    int cbcnt_srv_request_ref = 0;
+    int cbcnt_srv_response_ref = 0;
+
+    void cbHookRef(CanasInstance* pi, const CanasHookCallbackRefArgs* pargs)
+    {
+        CHECKPTR(pi);
+        CHECKPTR(pargs);
+        CHECKPTR(pargs->pmessage);
+        cbargs_hook_ref = *pargs;
+        cbmsg_hook_ref = *pargs->pmessage;
+        cbcnt_hook_ref++;
+    }
+
+    void cbParamRef(CanasInstance* pi, const CanasParamCallbackRefArgs* pargs)
+    {
+        CHECKPTR(pi);
+        CHECKPTR(pargs);
+        CHECKPTR(pargs->pentry);
+        cbargs_param_ref = *pargs;
+        cbentry_param_ref = *pargs->pentry;
+        cbcnt_param_ref++;
+    }
+
+    void cbSrvRequestRef(CanasInstance* pi, const CanasServiceRequestCallbackRefArgs* pargs)
+    {
+        CHECKPTR(pi);
+        CHECKPTR(pargs);
+        CHECKPTR(pargs->pmessage);
+        cbargs_srv_request_ref = *pargs;
+        cbmsg_srv_request_ref = *pargs->pmessage;
+        cbcnt_srv_request_ref++;
+    }
+
+    void cbSrvResponseRef(CanasInstance* pi, const CanasServiceResponseCallbackRefArgs* pargs)
+    {
+        CHECKPTR(pi);
+        CHECKPTR(pargs);
+        CHECKPTR(pargs->pmessage);
+        cbargs_srv_response_ref = *pargs;
+        cbmsg_srv_response_ref = *pargs->pmessage;
+        cbcnt_srv_response_ref++;
+    }
+
     CanasConfig makeGenericConfig()
     {
         CanasConfig cfg = canasMakeConfig();
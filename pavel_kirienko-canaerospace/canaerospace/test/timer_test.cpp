@@ -0,0 +1,183 @@
+/*
+ * Tests of the timer wheel
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ */
+
+#include "test.hpp"
+
+namespace
+{
+    int cbcnt_timer = 0;
+    uint64_t cbts_timer = 0;
+
+    void cbTimer(CanasInstance* pi, CanasTimer* ptimer, uint64_t timestamp_usec)
+    {
+        CHECKPTR(pi);
+        CHECKPTR(ptimer);
+        EXPECT_FALSE(canasTimerIsPending(ptimer));
+        EXPECT_LE(ptimer->deadline_usec, timestamp_usec);
+        cbcnt_timer++;
+        cbts_timer = timestamp_usec;
+    }
+
+    /// Restarts itself with the period stored in the argument
+    void cbTimerPeriodic(CanasInstance* pi, CanasTimer* ptimer, uint64_t timestamp_usec)
+    {
+        cbTimer(pi, ptimer, timestamp_usec);
+        const uint64_t period = *static_cast<uint64_t*>(ptimer->parg);
+        EXPECT_EQ(0, canasTimerStart(pi, ptimer, ptimer->deadline_usec + period, cbTimerPeriodic, ptimer->parg));
+    }
+
+    /// Stops the timer passed as the argument
+    void cbTimerStopOther(CanasInstance* pi, CanasTimer* ptimer, uint64_t timestamp_usec)
+    {
+        cbTimer(pi, ptimer, timestamp_usec);
+        canasTimerStop(pi, static_cast<CanasTimer*>(ptimer->parg));
+    }
+}
+
+TEST(TimerTest, Basic)
+{
+    CanasInstance inst = makeGenericInstance();
+    CanasTimer timer;
+    std::memset(&timer, 0, sizeof(timer));
+    cbcnt_timer = 0;
+
+    EXPECT_EQ(CANAS_DEADLINE_NONE, canasGetNextDeadline(&inst));
+    EXPECT_EQ(-CANAS_ERR_ARGUMENT, canasTimerStart(&inst, &timer, 1000, NULL, NULL));
+    EXPECT_FALSE(canasTimerIsPending(&timer));
+
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, -1, NULL, 1000000));
+    EXPECT_EQ(0, canasTimerStart(&inst, &timer, 1012345, cbTimer, NULL));
+    EXPECT_TRUE(canasTimerIsPending(&timer));
+    EXPECT_EQ(1012345, canasGetNextDeadline(&inst));
+
+    // Not yet, even within the same tick:
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, -1, NULL, 1010000));
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, -1, NULL, 1012344));
+    EXPECT_EQ(0, cbcnt_timer);
+
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, -1, NULL, 1012345));
+    EXPECT_EQ(1, cbcnt_timer);
+    EXPECT_EQ(1012345, cbts_timer);
+    EXPECT_FALSE(canasTimerIsPending(&timer));
+    EXPECT_EQ(CANAS_DEADLINE_NONE, canasGetNextDeadline(&inst));
+
+    // Stopped timer never fires:
+    EXPECT_EQ(0, canasTimerStart(&inst, &timer, 1100000, cbTimer, NULL));
+    canasTimerStop(&inst, &timer);
+    canasTimerStop(&inst, &timer);                       // Harmless
+    EXPECT_FALSE(canasTimerIsPending(&timer));
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, -1, NULL, 1200000));
+    EXPECT_EQ(1, cbcnt_timer);
+
+    // Rescheduling:
+    EXPECT_EQ(0, canasTimerStart(&inst, &timer, 1300000, cbTimer, NULL));
+    EXPECT_EQ(0, canasTimerStart(&inst, &timer, 1250000, cbTimer, NULL));
+    EXPECT_EQ(1250000, canasGetNextDeadline(&inst));
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, -1, NULL, 1260000));
+    EXPECT_EQ(2, cbcnt_timer);
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, -1, NULL, 1400000));
+    EXPECT_EQ(2, cbcnt_timer);
+
+    // Overdue timer fires at the next update:
+    EXPECT_EQ(0, canasTimerStart(&inst, &timer, 5, cbTimer, NULL));
+    EXPECT_EQ(5, canasGetNextDeadline(&inst));
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, -1, NULL, 1400001));
+    EXPECT_EQ(3, cbcnt_timer);
+}
+
+TEST(TimerTest, Ordering)
+{
+    CanasInstance inst = makeGenericInstance();
+    const int NUM_TIMERS = 300;
+    CanasTimer timers[NUM_TIMERS];
+    std::memset(timers, 0, sizeof(timers));
+    cbcnt_timer = 0;
+
+    // Spread over all levels of the wheel, beyond its range as well:
+    uint64_t deadlines[NUM_TIMERS];
+    const uint64_t start = 1000000000;
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, -1, NULL, start));
+    for (int i = 0; i < NUM_TIMERS; i++)
+    {
+        deadlines[i] = start + (uint64_t(i) * i * i * 7919) % 900000000 + 1;
+        EXPECT_EQ(0, canasTimerStart(&inst, timers + i, deadlines[i], cbTimer, NULL));
+    }
+
+    // Follow the deadlines reported by the library, making sure that nothing fires early or late
+    uint64_t now = start;
+    int iterations = 0;
+    while (cbcnt_timer < NUM_TIMERS)
+    {
+        ASSERT_LT(iterations++, 100000);
+        const uint64_t deadline = canasGetNextDeadline(&inst);
+        ASSERT_NE(CANAS_DEADLINE_NONE, deadline);
+        ASSERT_GE(deadline, now) << "Deadline must not go back";
+        now = deadline;
+        int expected = 0;
+        for (int i = 0; i < NUM_TIMERS; i++)
+            expected += (deadlines[i] <= now) ? 1 : 0;
+        EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, -1, NULL, now));
+        ASSERT_EQ(expected, cbcnt_timer);
+    }
+    for (int i = 0; i < NUM_TIMERS; i++)
+        EXPECT_FALSE(canasTimerIsPending(timers + i));
+    EXPECT_EQ(CANAS_DEADLINE_NONE, canasGetNextDeadline(&inst));
+}
+
+TEST(TimerTest, TimeJump)
+{
+    CanasInstance inst = makeGenericInstance();
+    CanasTimer near_timer, far_timer;
+    std::memset(&near_timer, 0, sizeof(near_timer));
+    std::memset(&far_timer, 0, sizeof(far_timer));
+    cbcnt_timer = 0;
+
+    // The wheel has never been advanced, so it starts from zero:
+    EXPECT_EQ(0, canasTimerStart(&inst, &near_timer, 3600ull * 1000000, cbTimer, NULL));
+    EXPECT_EQ(0, canasTimerStart(&inst, &far_timer, 24 * 3600ull * 1000000, cbTimer, NULL));
+
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, -1, NULL, 3600ull * 1000000 - 1));
+    EXPECT_EQ(0, cbcnt_timer);
+    EXPECT_EQ(3600ull * 1000000, canasGetNextDeadline(&inst));
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, -1, NULL, 3600ull * 1000000));
+    EXPECT_EQ(1, cbcnt_timer);
+
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, -1, NULL, 24 * 3600ull * 1000000 - 1));
+    EXPECT_EQ(1, cbcnt_timer);
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, -1, NULL, 48 * 3600ull * 1000000));
+    EXPECT_EQ(2, cbcnt_timer);
+    EXPECT_EQ(48 * 3600ull * 1000000, cbts_timer);
+}
+
+TEST(TimerTest, CallbacksModifyingTimers)
+{
+    CanasInstance inst = makeGenericInstance();
+    CanasTimer periodic, stopper, victim;
+    std::memset(&periodic, 0, sizeof(periodic));
+    std::memset(&stopper, 0, sizeof(stopper));
+    std::memset(&victim, 0, sizeof(victim));
+    cbcnt_timer = 0;
+
+    uint64_t period = 25000;
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, -1, NULL, 1000000));
+    EXPECT_EQ(0, canasTimerStart(&inst, &periodic, 1000000 + period, cbTimerPeriodic, &period));
+
+    // Victim is in the same slot as the stopper, it must not fire:
+    EXPECT_EQ(0, canasTimerStart(&inst, &victim, 1100001, cbTimer, NULL));
+    EXPECT_EQ(0, canasTimerStart(&inst, &stopper, 1100000, cbTimerStopOther, &victim));
+
+    EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, -1, NULL, 1100001));
+    // Periodic catches up on all missed periods while the wheel advances
+    EXPECT_EQ(1 + 4, cbcnt_timer);
+    EXPECT_FALSE(canasTimerIsPending(&victim));
+    EXPECT_TRUE(canasTimerIsPending(&periodic));
+
+    for (uint64_t ts = 1100001; ts < 2000000; ts += 1000)
+        EXPECT_EQ(0, _canasUpdateWithTimestamp(&inst, -1, NULL, ts));
+    EXPECT_EQ(1 + 4 + 35, cbcnt_timer);
+
+    canasTimerStop(&inst, &periodic);
+    EXPECT_EQ(CANAS_DEADLINE_NONE, canasGetNextDeadline(&inst));
+}
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+#
+# Generates the parameter metadata registry from the parameter ID headers.
+# Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+#
+# The enumerators are taken with the doc comment that precedes them:
+#     /**
+#      * Types: FLOAT SHORT2        (or "Type:")
+#      * Units: deg/s               (optional)
+#      * Rate: 50                   (optional, nominal transmission rate in Hz)
+#      */
+#     CANAS_NOD_DEF_BODY_PITCH_RATE = 303,
+# A trailing "///< Units: ..." comment overrides the units of a single enumerator.
+#
+# Usage:
+#     tools/gen_param_registry.py > src/param_registry_default.c
+#     tools/gen_param_registry.py --cpp > include/canaerospace/param_id/param_bindings.hpp
+#
+
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+
+SOURCES = [
+    ('canaerospace/param_id/nod_default.h', 'CANAS_NOD_DEF_'),
+    ('canaerospace/param_id/uav.h',         'CANAS_'),
+]
+
+# Source tree, then the installed layout: <prefix>/src/canaerospace/tools and <prefix>/include
+INCLUDE_DIRS = [os.path.join(ROOT, 'include'), os.path.join(ROOT, '..', '..', 'include')]
+
+DATATYPES = [
+    'NODATA', 'ERROR', 'FLOAT', 'LONG', 'ULONG', 'BLONG', 'SHORT', 'USHORT', 'BSHORT', 'CHAR', 'UCHAR', 'BCHAR',
+    'SHORT2', 'USHORT2', 'BSHORT2', 'CHAR4', 'UCHAR4', 'BCHAR4', 'CHAR2', 'UCHAR2', 'BCHAR2', 'MEMID', 'CHKSUM',
+    'ACHAR', 'ACHAR2', 'ACHAR4', 'CHAR3', 'UCHAR3', 'BCHAR3', 'ACHAR3', 'DOUBLEH', 'DOUBLEL'
+]
+
+RE_ENUMERATOR = re.compile(r'^\s*(CANAS_\w+)\s*(?:=\s*(\d+))?\s*,?\s*(?://[/!]<\s*(.*))?$')
+RE_FIELD = re.compile(r'^\s*\*\s*(Types?|Units|Rate):\s*(.*?)\s*$')
+
+
+def fail(msg):
+    sys.stderr.write('gen_param_registry: %s\n' % msg)
+    sys.exit(1)
+
+
+def normalize_units(units):
+    units = units.strip().rstrip('.')
+    if ' for ' in units:                      # "1/min N1 for jet engines, ..." --> "1/min"
+        units = units.split()[0]
+    return units
+
+
+def parse_header(path, prefix):
+    entries = []
+    block, in_block, value = {}, False, None
+    for line in open(path):
+        stripped = line.strip()
+        if stripped.startswith('/**'):
+            block, in_block = {}, True
+            continue
+        if in_block:
+            m = RE_FIELD.match(line)
+            if m:
+                block[m.group(1).rstrip('s')] = m.group(2)
+            if stripped.endswith('*/'):
+                in_block = False
+            continue
+
+        m = RE_ENUMERATOR.match(line)
+        if not m:
+            continue
+        name, explicit_value, trailing = m.groups()
+        value = int(explicit_value) if explicit_value is not None else value + 1
+        if 'Type' not in block:
+            fail('%s: no data types for %s' % (path, name))
+
+        types = [t.strip('/') for t in block['Type'].split()]
+        for t in types:
+            if t not in DATATYPES:
+                fail('%s: unknown data type %s for %s' % (path, t, name))
+
+        units = block.get('Unit', '')
+        if trailing and trailing.startswith('Units:'):
+            units = trailing[len('Units:'):]
+
+        entries.append({
+            'id': value,
+            'symbol': name,
+            'name': name[len(prefix):] if name.startswith(prefix) else name,
+            'types': types,
+            'units': normalize_units(units),
+            'rate': int(block.get('Rate', '0') or 0),
+        })
+    return entries
+
+
+def write_registry(out, entries, registry_name):
+    """Writes the entries sorted by ID, and the registry that refers to them"""
+    out.write('#define T(x) CANAS_PARAM_TYPE_BIT(CANAS_DATATYPE_##x)\n\n')
+    out.write('static const CanasParamMeta _entries[] =\n{\n')
+    for e in sorted(entries, key=lambda e: e['id']):
+        mask = ' | '.join('T(%s)' % t for t in e['types'])
+        out.write('    { %4d, %3d, %s, "%s", "%s" },\n' % (e['id'], e['rate'], mask, e['name'], e['units']))
+    out.write('};\n\n')
+    out.write('#undef T\n\n')
+    out.write('const CanasParamRegistry %s =\n{\n' % registry_name)
+    out.write('    _entries,\n    sizeof(_entries) / sizeof(_entries[0])\n};\n')
+
+
+def standard_entries():
+    """Entries of all the standard headers, sorted by ID"""
+    entries = []
+    for path, prefix in SOURCES:
+        candidates = [os.path.join(d, path) for d in INCLUDE_DIRS if os.path.isfile(os.path.join(d, path))]
+        if not candidates:
+            fail('%s is not found in %s' % (path, ', '.join(INCLUDE_DIRS)))
+        entries += parse_header(candidates[0], prefix)
+    entries.sort(key=lambda e: e['id'])
+    for a, b in zip(entries, entries[1:]):
+        if a['id'] == b['id']:
+            fail('duplicate message ID %d: %s, %s' % (a['id'], a['name'], b['name']))
+    return entries
+
+
+def write_banner(out, title):
+    out.write('/*\n')
+    out.write(' * %s\n' % title)
+    out.write(' * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)\n')
+    out.write(' */\n\n')
+    out.write('/*\n * Generated by tools/gen_param_registry.py from %s. Do not edit.\n */\n\n' %
+              ', '.join(os.path.basename(p) for p, _ in SOURCES))
+
+
+def write_cpp_bindings(out, entries):
+    guard = 'CANAEROSPACE_PARAM_ID_PARAM_BINDINGS_HPP_'
+    write_banner(out, 'Data types of the standard parameters for the typed C++ interface')
+    out.write('#ifndef %s\n#define %s\n\n' % (guard, guard))
+    out.write('#include "../canaerospace.hpp"\n')
+    for path, _ in SOURCES:
+        out.write('#include "%s"\n' % os.path.basename(path))
+    out.write('\n#define T(x) CANAS_PARAM_TYPE_BIT(CANAS_DATATYPE_##x)\n\n')
+    out.write('namespace canaerospace\n{\n')
+    for e in entries:
+        mask = ' | '.join('T(%s)' % t for t in e['types'])
+        out.write('CANAS_CPP_PARAM_BINDING(%s, %s)\n' % (e['symbol'], mask))
+    out.write('}\n\n#undef T\n\n#endif\n')
+
+
+def main():
+    entries = standard_entries()
+    out = sys.stdout
+    if sys.argv[1:] == ['--cpp']:
+        write_cpp_bindings(out, entries)
+        return
+    if len(sys.argv) > 1:
+        fail('usage: gen_param_registry.py [--cpp]')
+    write_banner(out, 'Parameter registry for the default identifier distribution and the UAV extension')
+    out.write('#include <canaerospace/param_registry.h>\n\n')
+    write_registry(out, entries, 'canas_param_registry_default')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,393 @@
+#!/usr/bin/env python3
+#
+# Generates a parameter set from its definition file.
+# Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+#
+# The definition file is CSV with the header line; empty lines and lines starting with '#' are ignored:
+#     id,   name,             type,   rate, redundancy, direction, units, handler
+#     200,  ESC_COMMAND_1,    USHORT, 100,  1,          out,       ,
+#     1810, GIMBAL_ROLL,      FLOAT,  50,   2,          in,        deg,   onGimbalRoll
+# Where:
+#     type       - CANaerospace data type without the CANAS_DATATYPE_ prefix
+#     rate       - nominal rate in Hz, 0 if not specified
+#     redundancy - number of redundancy channels to subscribe to; ignored for outgoing parameters
+#     direction  - 'in' to subscribe, 'out' to advertise
+#     units      - optional
+#     handler    - optional, for incoming parameters only. A function to be defined by the application:
+#                      void handler(CanasInstance* pi, uint8_t redund_chan, <type> value);
+#
+# The outputs for the set <name> are:
+#     <name>.h   - Message ID enum, typed accessors, handler prototypes
+#     <name>.c   - metadata registry, static table for CanasConfig.pstatic_table, accessors
+#     <name>.hpp - bindings and typedefs for canaerospace.hpp
+#
+# By default the set has its own Message ID distribution, and the C++ header binds all of its IDs.
+# With --standard-ids the set follows the standard distribution: the data type of a standard Message ID must be one
+# of those allowed by the ID headers, and the C++ header takes their bindings from param_id/param_bindings.hpp.
+#
+# The set is loaded by canasInit(); the accessors then address the subscriptions and the advertisements in the
+# static storage directly, without lookups. Since the storage is static, a set can be loaded by one instance only.
+#
+# Usage:
+#     tools/gen_param_set.py [--standard-ids] <definition.csv> <output directory> [set name]
+# The set name defaults to the name of the definition file.
+#
+
+import csv
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from gen_param_registry import write_registry, standard_entries
+
+# Data type --> (C type, number of elements)
+DATATYPES = {
+    'ERROR':   ('uint32_t', 1),
+    'FLOAT':   ('float',    1),
+    'LONG':    ('int32_t',  1),
+    'ULONG':   ('uint32_t', 1),
+    'BLONG':   ('uint32_t', 1),
+    'SHORT':   ('int16_t',  1),
+    'USHORT':  ('uint16_t', 1),
+    'BSHORT':  ('uint16_t', 1),
+    'CHAR':    ('int8_t',   1),
+    'UCHAR':   ('uint8_t',  1),
+    'BCHAR':   ('uint8_t',  1),
+    'SHORT2':  ('int16_t',  2),
+    'USHORT2': ('uint16_t', 2),
+    'BSHORT2': ('uint16_t', 2),
+    'CHAR4':   ('int8_t',   4),
+    'UCHAR4':  ('uint8_t',  4),
+    'BCHAR4':  ('uint8_t',  4),
+    'CHAR2':   ('int8_t',   2),
+    'UCHAR2':  ('uint8_t',  2),
+    'BCHAR2':  ('uint8_t',  2),
+    'MEMID':   ('uint32_t', 1),
+    'CHKSUM':  ('uint32_t', 1),
+    'ACHAR':   ('uint8_t',  1),
+    'ACHAR2':  ('uint8_t',  2),
+    'ACHAR4':  ('uint8_t',  4),
+    'CHAR3':   ('int8_t',   3),
+    'UCHAR3':  ('uint8_t',  3),
+    'BCHAR3':  ('uint8_t',  3),
+    'ACHAR3':  ('uint8_t',  3),
+    'DOUBLEH': ('uint32_t', 1),
+    'DOUBLEL': ('uint32_t', 1),
+}
+
+# Message ID ranges of the parameters, see CanasMessageTypeID
+PARAM_ID_RANGES = [(0, 127), (200, 299), (300, 1799), (1800, 1899)]
+
+COLUMNS = ['id', 'name', 'type', 'rate', 'redundancy', 'direction']
+
+
+def fail(msg):
+    sys.stderr.write('gen_param_set: %s\n' % msg)
+    sys.exit(1)
+
+
+def camel(name):
+    return ''.join(w.capitalize() for w in name.lower().split('_'))
+
+
+def parse_definition(path):
+    lines = [l for l in open(path) if l.strip() and not l.lstrip().startswith('#')]
+    reader = csv.DictReader(lines, skipinitialspace=True)
+    reader.fieldnames = [f.strip().lower() for f in reader.fieldnames]
+    for c in COLUMNS:
+        if c not in reader.fieldnames:
+            fail('%s: column "%s" is missing' % (path, c))
+
+    params, ids, names = [], set(), set()
+    for row in reader:
+        row = dict((k, (v or '').strip()) for k, v in row.items() if k is not None)
+        where = '%s:%d' % (path, reader.line_num)
+        p = {
+            'id': int(row['id'], 0),
+            'name': row['name'].upper(),
+            'type': row['type'].upper(),
+            'rate': int(row['rate'] or 0),
+            'redundancy': int(row['redundancy'] or 1),
+            'direction': row['direction'].lower(),
+            'units': row.get('units', ''),
+            'handler': row.get('handler', ''),
+        }
+        if not any(lo <= p['id'] <= hi for lo, hi in PARAM_ID_RANGES):
+            fail('%s: %d is not a parameter Message ID' % (where, p['id']))
+        if not re.match(r'^[A-Z][A-Z0-9_]*$', p['name']):
+            fail('%s: invalid name "%s"' % (where, p['name']))
+        if p['type'] not in DATATYPES:
+            fail('%s: unknown data type "%s"' % (where, p['type']))
+        if p['direction'] not in ('in', 'out'):
+            fail('%s: direction must be "in" or "out"' % where)
+        if not 1 <= p['redundancy'] <= 255:
+            fail('%s: invalid redundancy count' % where)
+        if p['handler'] and p['direction'] != 'in':
+            fail('%s: handlers are only allowed for incoming parameters' % where)
+        if p['id'] in ids or p['name'] in names:
+            fail('%s: duplicate parameter' % where)
+        ids.add(p['id'])
+        names.add(p['name'])
+        params.append(p)
+    return params
+
+
+class SetWriter:
+    def __init__(self, set_name, source_name, params, standard_ids):
+        self.set_name = set_name
+        self.source_name = source_name
+        self.params = params
+        self.standard_ids = standard_ids
+        self.prefix = 'CANAS_%s_' % set_name.upper()
+        self.fn_prefix = 'canas' + camel(set_name)
+        self.subs = [p for p in params if p['direction'] == 'in']
+        self.advs = [p for p in params if p['direction'] == 'out']
+
+    def enum(self, p):
+        return self.prefix + p['name']
+
+    def value_arg(self, p, out):
+        ctype, count = DATATYPES[p['type']]
+        if count == 1:
+            return ('%s* pvalue' % ctype) if out else ('%s value' % ctype)
+        return ('%s value[%d]' % (ctype, count)) if out else ('const %s value[%d]' % (ctype, count))
+
+    def read_proto(self, p):
+        return 'int %sRead%s(uint8_t redund_chan, %s, uint64_t* ptimestamp_usec)' % \
+            (self.fn_prefix, camel(p['name']), self.value_arg(p, True))
+
+    def publish_proto(self, p):
+        return 'int %sPublish%s(CanasInstance* pi, %s)' % (self.fn_prefix, camel(p['name']), self.value_arg(p, False))
+
+    def handler_proto(self, p):
+        return 'void %s(CanasInstance* pi, uint8_t redund_chan, %s)' % (p['handler'], self.value_arg(p, False))
+
+    def banner(self, out):
+        out.write('/*\n * Parameter set %s\n' % self.set_name)
+        out.write(' * Generated by tools/gen_param_set.py from %s. Do not edit.\n */\n\n' % self.source_name)
+
+    def write_header(self, out):
+        guard = 'CANAS_PARAM_SET_%s_H_' % self.set_name.upper()
+        self.banner(out)
+        out.write('#ifndef %s\n#define %s\n\n' % (guard, guard))
+        out.write('#include <canaerospace/canaerospace.h>\n\n')
+        out.write('#ifdef __cplusplus\nextern "C" {\n#endif\n\n')
+
+        out.write('typedef enum\n{\n')
+        for i, p in enumerate(self.params):
+            sep = ',' if i + 1 < len(self.params) else ''
+            note = '%s, %s' % (p['type'], 'subscribed' if p['direction'] == 'in' else 'advertised')
+            if p['units']:
+                note += ', ' + p['units']
+            out.write('    %-60s///< %s\n' % ('%s = %d%s' % (self.enum(p), p['id'], sep), note))
+        out.write('} Canas%sMsgId;\n\n' % camel(self.set_name))
+
+        out.write('/**\n * Metadata of this set, for @ref CanasConfig.pparam_registry.\n */\n')
+        out.write('extern const CanasParamRegistry %sregistry;\n\n' % self.prefix.lower())
+        out.write('/**\n * Subscriptions and advertisements of this set, for @ref CanasConfig.pstatic_table.\n */\n')
+        out.write('extern const CanasStaticTable %stable;\n\n' % self.prefix.lower())
+
+        handlers = [p for p in self.subs if p['handler']]
+        if handlers:
+            out.write('/*\n * To be defined by the application.\n */\n')
+            for p in handlers:
+                out.write('%s;\n' % self.handler_proto(p))
+            out.write('\n')
+
+        if self.subs:
+            out.write('/*\n * Last received values; the timestamp is optional.\n')
+            out.write(' * These functions return -CANAS_ERR_BAD_DATA_TYPE until the first value is received.\n */\n')
+            for p in self.subs:
+                out.write('%s;\n' % self.read_proto(p))
+            out.write('\n')
+        if self.advs:
+            out.write('/*\n * Publication, with zero Service Code.\n */\n')
+            for p in self.advs:
+                out.write('%s;\n' % self.publish_proto(p))
+            out.write('\n')
+
+        out.write('#ifdef __cplusplus\n}\n#endif\n#endif\n')
+
+    def write_source(self, out):
+        self.banner(out)
+        out.write('#include <string.h>\n#include "%s.h"\n\n' % self.set_name)
+
+        write_registry(out, [dict(p, types=[p['type']]) for p in self.params], self.prefix.lower() + 'registry')
+        out.write('\n')
+
+        if self.subs:
+            self.write_subscriptions(out)
+        if self.advs:
+            self.write_advertisements(out)
+
+        out.write('const CanasStaticTable %stable =\n{\n' % self.prefix.lower())
+        if self.subs:
+            out.write('    _subscriptions, _subscription_storage, %d,\n' % len(self.subs))
+        else:
+            out.write('    NULL, NULL, 0,\n')
+        if self.advs:
+            out.write('    _advertisements, _advertisement_storage, %d\n' % len(self.advs))
+        else:
+            out.write('    NULL, NULL, 0\n')
+        out.write('};\n')
+
+        if self.subs:
+            self.write_readers(out)
+        if self.advs:
+            self.write_publishers(out)
+
+    def write_subscriptions(self, out):
+        out.write('/*\n * canasInit() lays the subscriptions out in the storage in the order of the table,\n')
+        out.write(' * so their offsets are known at compile time.\n */\n')
+        out.write('enum\n{\n')
+        prev = None
+        for p in self.subs:
+            if prev is None:
+                out.write('    OFFSET_%s = 0,\n' % p['name'])
+            else:
+                out.write('    OFFSET_%s = OFFSET_%s + CANAS_PARAM_SUBSCRIPTION_SIZE(%d),\n' %
+                          (p['name'], prev['name'], prev['redundancy']))
+            prev = p
+        out.write('    SUBSCRIPTION_STORAGE_SIZE = OFFSET_%s + CANAS_PARAM_SUBSCRIPTION_SIZE(%d)\n};\n\n' %
+                  (prev['name'], prev['redundancy']))
+
+        for p in self.subs:
+            if not p['handler']:
+                continue
+            ctype, count = DATATYPES[p['type']]
+            out.write('static void _on%s(CanasInstance* pi, const CanasParamCallbackRefArgs* pargs)\n{\n' %
+                      camel(p['name']))
+            out.write('    const CanasMessageData* pdata = &pargs->pentry->message.data;\n')
+            out.write('    if (pdata->type == CANAS_DATATYPE_%s)\n' % p['type'])
+            out.write('        %s(pi, pargs->redund_channel_id, pdata->container.%s);\n}\n\n' %
+                      (p['handler'], p['type']))
+
+        out.write('static const CanasStaticSubscription _subscriptions[] =\n{\n')
+        for p in self.subs:
+            callback = ('_on' + camel(p['name'])) if p['handler'] else 'NULL'
+            out.write('    { %s, %d, NULL, %s, NULL },\n' % (self.enum(p), p['redundancy'], callback))
+        out.write('};\n\n')
+        out.write('static uint64_t _subscription_storage[SUBSCRIPTION_STORAGE_SIZE / 8];\n\n')
+
+    def write_advertisements(self, out):
+        out.write('enum\n{\n')
+        for i, p in enumerate(self.advs):
+            out.write('    INDEX_%s = %d%s\n' % (p['name'], i, ',' if i + 1 < len(self.advs) else ''))
+        out.write('};\n\n')
+        out.write('static const CanasStaticAdvertisement _advertisements[] =\n{\n')
+        for p in self.advs:
+            out.write('    { %s, false },\n' % self.enum(p))
+        out.write('};\n\n')
+        out.write('static CanasParamAdvertisement _advertisement_storage[%d];\n\n' % len(self.advs))
+
+    def write_readers(self, out):
+        out.write('''
+static int _readCacheEntry(int offset, uint16_t msg_id, uint8_t redund_chan, uint8_t datatype,
+                           CanasParamCacheEntry* pentry)
+{
+    const CanasParamSubscription* psub =
+        (const CanasParamSubscription*)((const uint8_t*)_subscription_storage + offset);
+    if (psub->message_id != msg_id)
+        return -CANAS_ERR_NO_SUCH_ENTRY;                // Not loaded or removed
+    if (redund_chan >= psub->redund_count)
+        return -CANAS_ERR_BAD_REDUND_CHAN;
+    const int res = canasParamCacheCopy(psub->redund_cache + redund_chan, pentry);
+    if (res != 0)
+        return res;
+    if (pentry->message.data.type != datatype)
+        return -CANAS_ERR_BAD_DATA_TYPE;
+    return 0;
+}
+''')
+        for p in self.subs:
+            ctype, count = DATATYPES[p['type']]
+            out.write('\n%s\n{\n' % self.read_proto(p))
+            out.write('    CanasParamCacheEntry entry;\n')
+            out.write('    const int res = _readCacheEntry(OFFSET_%s, %s, redund_chan,\n' % (p['name'], self.enum(p)))
+            out.write('                                    CANAS_DATATYPE_%s, &entry);\n' % p['type'])
+            out.write('    if (res != 0)\n        return res;\n')
+            if count == 1:
+                out.write('    if (pvalue != NULL)\n')
+                out.write('        *pvalue = entry.message.data.container.%s;\n' % p['type'])
+            else:
+                out.write('    if (value != NULL)\n')
+                out.write('        memcpy(value, entry.message.data.container.%s, sizeof(%s) * %d);\n' %
+                          (p['type'], ctype, count))
+            out.write('    if (ptimestamp_usec != NULL)\n')
+            out.write('        *ptimestamp_usec = entry.timestamp_usec;\n')
+            out.write('    return 0;\n}\n')
+
+    def write_publishers(self, out):
+        out.write('''
+static int _publish(CanasInstance* pi, int index, uint16_t msg_id, const CanasMessageData* pdata)
+{
+    CanasParamAdvertisement* padv = _advertisement_storage + index;
+    if (padv->message_id != msg_id)
+        return -CANAS_ERR_NO_SUCH_ENTRY;                // Not loaded or removed
+    return canasParamPublishHandle(pi, padv, pdata, 0);
+}
+''')
+        for p in self.advs:
+            ctype, count = DATATYPES[p['type']]
+            out.write('\n%s\n{\n' % self.publish_proto(p))
+            out.write('    CanasMessageData msgd;\n')
+            out.write('    msgd.type = CANAS_DATATYPE_%s;\n' % p['type'])
+            out.write('    msgd.length = 0;\n')
+            if count == 1:
+                out.write('    msgd.container.%s = value;\n' % p['type'])
+            else:
+                out.write('    memcpy(msgd.container.%s, value, sizeof(%s) * %d);\n' % (p['type'], ctype, count))
+            out.write('    return _publish(pi, INDEX_%s, %s, &msgd);\n}\n' % (p['name'], self.enum(p)))
+
+    def write_cpp_header(self, out):
+        guard = 'CANAS_PARAM_SET_%s_HPP_' % self.set_name.upper()
+        self.banner(out)
+        out.write('#ifndef %s\n#define %s\n\n' % (guard, guard))
+        out.write('#include <canaerospace/canaerospace.hpp>\n')
+        if any(p['id'] in self.standard_ids for p in self.params):
+            out.write('#include <canaerospace/param_id/param_bindings.hpp>\n')
+        out.write('#include "%s.h"\n\n' % self.set_name)
+        out.write('namespace canaerospace\n{\n')
+        for p in self.params:
+            if p['id'] not in self.standard_ids:    # Already bound in param_id/param_bindings.hpp
+                out.write('CANAS_CPP_PARAM_BINDING(%s, CANAS_PARAM_TYPE_BIT(CANAS_DATATYPE_%s))\n' %
+                          (self.enum(p), p['type']))
+        out.write('}\n\n')
+        out.write('namespace %s\n{\n' % self.set_name)
+        for p in self.params:
+            out.write('typedef canaerospace::Param<%s, canaerospace::DataType<CANAS_DATATYPE_%s>::ValueType,\n' %
+                      (self.enum(p), p['type']))
+            out.write('                            CANAS_DATATYPE_%s> %s;\n' % (p['type'], camel(p['name'])))
+        out.write('}\n\n#endif\n')
+
+
+def main():
+    args = sys.argv[1:]
+    use_standard_ids = bool(args) and args[0] == '--standard-ids'
+    if use_standard_ids:
+        args = args[1:]
+    if len(args) not in (2, 3):
+        fail('usage: gen_param_set.py [--standard-ids] <definition.csv> <output directory> [set name]')
+    path, outdir = args[0], args[1]
+    set_name = args[2] if len(args) > 2 else os.path.splitext(os.path.basename(path))[0]
+    if not re.match(r'^[a-z][a-z0-9_]*$', set_name):
+        fail('set name must be a lowercase C identifier: %s' % set_name)
+
+    params = parse_definition(path)
+    standard = dict((e['id'], e) for e in standard_entries()) if use_standard_ids else {}
+    for p in params:
+        if p['id'] in standard and p['type'] not in standard[p['id']]['types']:
+            fail('%s: %s is not allowed for the standard message ID %d (%s), expected %s' %
+                 (p['name'], p['type'], p['id'], standard[p['id']]['symbol'], ' '.join(standard[p['id']]['types'])))
+
+    writer = SetWriter(set_name, os.path.basename(path), params, set(standard.keys()))
+    if not os.path.isdir(outdir):
+        os.makedirs(outdir)
+    for ext, fn in (('.h', writer.write_header), ('.c', writer.write_source), ('.hpp', writer.write_cpp_header)):
+        with open(os.path.join(outdir, set_name + ext), 'w') as out:
+            fn(out)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,34 @@
+#
+# Build-time generation of the parameter sets, see tools/gen_param_set.py.
+# Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+#
+# canas_add_param_set(<set name> <definition.csv> <output directory> [STANDARD_IDS])
+#   Adds the target <set name>_param_set that generates <set name>.h, .hpp and .c into the output directory.
+#   STANDARD_IDS is for the sets that follow the standard Message ID distribution, see --standard-ids.
+#   The generated source is returned in the variable <set name>_PARAM_SET_SOURCES; it should be compiled into
+#   the application, and the output directory should be added to the include path.
+#
+
+set(CANAS_TOOLS_DIR ${CMAKE_CURRENT_LIST_DIR})
+find_program(CANAS_PYTHON NAMES python3 python)
+
+function(canas_add_param_set name definition outdir)
+    if (NOT CANAS_PYTHON)
+        message(FATAL_ERROR "Python is required to generate the parameter set ${name}")
+    endif ()
+    set(options)
+    if ("${ARGN}" STREQUAL "STANDARD_IDS")
+        set(options --standard-ids)
+    elseif (ARGN)
+        message(FATAL_ERROR "Unexpected arguments of canas_add_param_set(): ${ARGN}")
+    endif ()
+    set(outputs ${outdir}/${name}.h ${outdir}/${name}.hpp ${outdir}/${name}.c)
+    add_custom_command(OUTPUT ${outputs}
+                       COMMAND ${CANAS_PYTHON} ${CANAS_TOOLS_DIR}/gen_param_set.py ${options} ${definition} ${outdir}
+                               ${name}
+                       DEPENDS ${definition} ${CANAS_TOOLS_DIR}/gen_param_set.py
+                               ${CANAS_TOOLS_DIR}/gen_param_registry.py
+                       COMMENT "Generating parameter set ${name}")
+    add_custom_target(${name}_param_set DEPENDS ${outputs})
+    set(${name}_PARAM_SET_SOURCES ${outdir}/${name}.c PARENT_SCOPE)
+endfunction()
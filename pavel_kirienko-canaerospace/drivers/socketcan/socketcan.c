@@ -3,14 +3,19 @@
  * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
  */
 
+#ifndef _GNU_SOURCE
+#  define _GNU_SOURCE         // sendmmsg(), recvmmsg()
+#endif
 #include <sys/socket.h>
 #include <sys/ioctl.h>
 #include <net/if.h>
 #include <linux/can.h>
 #include <linux/can/raw.h>
 #include <string.h>
+#include <errno.h>
 #include <unistd.h>
 #include <stdlib.h>
+#include <time.h>
 #include "socketcan.h"
 
 static int _sock(const char* ifname)
@@ -30,6 +35,10 @@ static int _sock(const char* ifname)
     addr.can_ifindex = ifr.ifr_ifindex;
     if (bind(s, (struct sockaddr*)&addr, sizeof(addr)) != 0)
         return -1;
+
+    // Reception timestamps are optional; if the kernel can't provide them, the frames will go without
+    const int on = 1;
+    (void)setsockopt(s, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on));
     return s;
 }
 
@@ -53,25 +62,32 @@ int canInit(const char* pifnames[], int* out_sockets, int ifcount)
     return -1;
 }
 
-int canSend(int fd, const CanasCanFrame* pframe)
+static int _toSocketCan(const CanasCanFrame* pframe, struct can_frame* pout)
 {
-    if (pframe == NULL)
-        return -1;
-
     if (pframe->dlc > 8)
         return -1;     // wtf
 
-    struct can_frame frame;
-    memset(&frame, 0, sizeof(struct can_frame));
+    memset(pout, 0, sizeof(struct can_frame));
 
-    frame.can_id = pframe->id & ((pframe->id & CANAS_CAN_FLAG_EFF) ? CANAS_CAN_MASK_EXTID : CANAS_CAN_MASK_STDID);
+    pout->can_id = pframe->id & ((pframe->id & CANAS_CAN_FLAG_EFF) ? CANAS_CAN_MASK_EXTID : CANAS_CAN_MASK_STDID);
     if (pframe->id & CANAS_CAN_FLAG_EFF)
-        frame.can_id |= CAN_EFF_FLAG;
+        pout->can_id |= CAN_EFF_FLAG;
     if (pframe->id & CANAS_CAN_FLAG_RTR)
-        frame.can_id |= CAN_RTR_FLAG;
+        pout->can_id |= CAN_RTR_FLAG;
 
-    memcpy(frame.data, pframe->data, pframe->dlc);
-    frame.can_dlc = pframe->dlc;
+    memcpy(pout->data, pframe->data, pframe->dlc);
+    pout->can_dlc = pframe->dlc;
+    return 0;
+}
+
+int canSend(int fd, const CanasCanFrame* pframe)
+{
+    if (pframe == NULL)
+        return -1;
+
+    struct can_frame frame;
+    if (_toSocketCan(pframe, &frame) != 0)
+        return -1;
 
     int written = write(fd, &frame, sizeof(struct can_frame));
     if (written <= 0)
@@ -81,31 +97,145 @@ int canSend(int fd, const CanasCanFrame* pframe)
     return 1;
 }
 
+int canSendMany(int fd, const CanasCanFrame* pframes, int nframes)
+{
+    if (pframes == NULL || nframes < 0)
+        return -1;
+
+    enum { CHUNK_LEN = 32 };
+    struct can_frame frames[CHUNK_LEN];
+    struct iovec iovs[CHUNK_LEN];
+    struct mmsghdr msgs[CHUNK_LEN];
+
+    int sent = 0;
+    while (sent < nframes)
+    {
+        const int chunk = (nframes - sent < CHUNK_LEN) ? (nframes - sent) : CHUNK_LEN;
+        memset(msgs, 0, sizeof(struct mmsghdr) * chunk);
+        for (int i = 0; i < chunk; i++)
+        {
+            if (_toSocketCan(pframes + sent + i, frames + i) != 0)
+                return sent ? sent : -1;
+            iovs[i].iov_base = frames + i;
+            iovs[i].iov_len = sizeof(struct can_frame);
+            msgs[i].msg_hdr.msg_iov = iovs + i;
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        const int res = sendmmsg(fd, msgs, chunk, 0);
+        if (res < 0)
+            return sent ? sent : res;
+        sent += res;
+        if (res < chunk)
+            break;           // TX queue is full, the rest would fail the same way
+    }
+    return sent;
+}
+
+static void _fromSocketCan(const struct can_frame* pframe, const struct msghdr* pmsg, CanasCanFrame* pout)
+{
+    memset(pout, 0, sizeof(*pout));
+
+    pout->dlc = (pframe->can_dlc > 8) ? 8 : pframe->can_dlc;
+    memcpy(pout->data, pframe->data, pout->dlc);
+
+    pout->id = pframe->can_id & ((pframe->can_id & CAN_EFF_FLAG) ? CAN_EFF_MASK : CAN_SFF_MASK);
+    if (pframe->can_id & CAN_EFF_FLAG)
+        pout->id |= CANAS_CAN_FLAG_EFF;
+    if (pframe->can_id & CAN_RTR_FLAG)
+        pout->id |= CANAS_CAN_FLAG_RTR;
+
+    for (struct cmsghdr* pcmsg = CMSG_FIRSTHDR(pmsg); pcmsg != NULL; pcmsg = CMSG_NXTHDR((struct msghdr*)pmsg, pcmsg))
+    {
+        if (pcmsg->cmsg_level == SOL_SOCKET && pcmsg->cmsg_type == SO_TIMESTAMPNS)
+        {
+            struct timespec ts;
+            memcpy(&ts, CMSG_DATA(pcmsg), sizeof(ts));
+            pout->timestamp_usec = ((uint64_t)ts.tv_sec) * 1000000ul + ts.tv_nsec / 1000;
+        }
+    }
+}
+
+/*
+ * CMSG_FIRSTHDR() and CMSG_NXTHDR() expect the buffer to be aligned as the header. The header itself can't be a member
+ * of a union here, since it ends with a flexible array and canReceiveMany() needs an array of these buffers.
+ */
+typedef struct
+{
+    uint8_t buf[CMSG_SPACE(sizeof(struct timespec))] __attribute__((aligned(__alignof__(struct cmsghdr))));
+} ControlBuffer;
+
+static void _initMsgHdr(struct msghdr* pmsg, struct iovec* piov, struct can_frame* pframe, ControlBuffer* pcontrol)
+{
+    memset(pmsg, 0, sizeof(*pmsg));
+    piov->iov_base = pframe;
+    piov->iov_len = sizeof(struct can_frame);
+    pmsg->msg_iov = piov;
+    pmsg->msg_iovlen = 1;
+    pmsg->msg_control = pcontrol->buf;
+    pmsg->msg_controllen = sizeof(pcontrol->buf);
+}
+
 int canReceive(int fd, CanasCanFrame* pframe)
 {
     if (pframe == NULL)
         return -1;
 
     struct can_frame frame;
+    struct iovec iov;
+    ControlBuffer control;
+    struct msghdr msg;
     memset(&frame, 0, sizeof(struct can_frame));
     memset(pframe, 0, sizeof(*pframe));
+    _initMsgHdr(&msg, &iov, &frame, &control);
 
-    int res = read(fd, &frame, sizeof(struct can_frame));
+    int res = recvmsg(fd, &msg, 0);
     if (res <= 0)
         return res;
     if (res != sizeof(struct can_frame))
         return -1; // epic fail, this frame is incomplete or we're using wrong socket
 
-    pframe->dlc = frame.can_dlc;
-    memcpy(pframe->data, frame.data, frame.can_dlc);
+    _fromSocketCan(&frame, &msg, pframe);
+    return 1;
+}
+
+int canReceiveMany(int fd, CanasCanFrame* pframes, int maxframes)
+{
+    if (pframes == NULL || maxframes < 0)
+        return -1;
 
-    pframe->id = frame.can_id & ((frame.can_id & CAN_EFF_FLAG) ? CAN_EFF_MASK : CAN_SFF_MASK);
-    if (frame.can_id & CAN_EFF_FLAG)
-        pframe->id |= CANAS_CAN_FLAG_EFF;
-    if (frame.can_id & CAN_RTR_FLAG)
-        pframe->id |= CANAS_CAN_FLAG_RTR;
+    enum { CHUNK_LEN = 32 };
+    struct can_frame frames[CHUNK_LEN];
+    struct iovec iovs[CHUNK_LEN];
+    ControlBuffer controls[CHUNK_LEN];
+    struct mmsghdr msgs[CHUNK_LEN];
 
-    return 1;
+    int received = 0;
+    while (received < maxframes)
+    {
+        const int chunk = (maxframes - received < CHUNK_LEN) ? (maxframes - received) : CHUNK_LEN;
+        for (int i = 0; i < chunk; i++)
+        {
+            _initMsgHdr(&msgs[i].msg_hdr, iovs + i, frames + i, controls + i);
+            msgs[i].msg_len = 0;
+        }
+
+        const int res = recvmmsg(fd, msgs, chunk, MSG_DONTWAIT, NULL);
+        if (res < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                break;
+            return received ? received : -1;
+        }
+        for (int i = 0; i < res; i++)
+        {
+            if (msgs[i].msg_len == sizeof(struct can_frame))  // Broken frames are dropped, see canReceive()
+                _fromSocketCan(frames + i, &msgs[i].msg_hdr, pframes + received++);
+        }
+        if (res < chunk)
+            break;           // Nothing left in the socket
+    }
+    return received;
 }
 
 int canFilterSetup(int fd, const CanasCanFilterConfig* pfilters, int filters_len)
@@ -36,6 +36,15 @@ int canInit(const char* pifnames[], int* out_sockets, int ifcount);
  */
 int canSend(int fd, const CanasCanFrame* pframe);
 
+/**
+ * Send a number of CAN frames through the socket with as few system calls as possible.
+ * @param [in] fd      Socket descriptor.
+ * @param [in] pframes Pointer to the array of frames to be sent in order.
+ * @param [in] nframes Length of the array.
+ * @return Number of frames sent, negative if none could be sent due to failure.
+ */
+int canSendMany(int fd, const CanasCanFrame* pframes, int nframes);
+
 /**
  * Setup CAN filters for the specified socket.
  * You need to match the interface index with the corresponding socket descriptor.
@@ -46,12 +55,24 @@ int canFilterSetup(int fd, const CanasCanFilterConfig* pfilters, int filters_len
 /**
  * Read a single frame from the socket.
  * You need to match the socket descriptor with the corresponding interface index.
+ * The frame will be stamped with the kernel reception time (CLOCK_REALTIME, same as gettimeofday()) if available,
+ * otherwise the timestamp will be zero.
  * @param [in] fd     Socket descriptor.
  * @param [in] pframe Pointer where to store the frame.
  * @return 1 if frame was received, 0 if not, negative on failure.
  */
 int canReceive(int fd, CanasCanFrame* pframe);
 
+/**
+ * Read all frames available in the socket, without blocking, with as few system calls as possible.
+ * The frames are stamped the same way as in @ref canReceive().
+ * @param [in] fd        Socket descriptor.
+ * @param [in] pframes   Pointer to the array where to store the frames.
+ * @param [in] maxframes Length of the array.
+ * @return Number of frames received, which may be zero; negative on failure.
+ */
+int canReceiveMany(int fd, CanasCanFrame* pframes, int maxframes);
+
 #ifdef __cplusplus
 }
 #endif
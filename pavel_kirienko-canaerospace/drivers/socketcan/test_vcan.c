@@ -0,0 +1,114 @@
+/*
+ * Test of the SocketCAN adapter on a virtual interface. It is skipped if the interface is not available.
+ * Pavel Kirienko, 2013 (pavel.kirienko@gmail.com)
+ *
+ * The interface can be created like this:
+ *     modprobe vcan
+ *     ip link add dev vcan0 type vcan
+ *     ip link set up vcan0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include "socketcan.h"
+
+#define ENFORCE(x)                                                          \
+    if (!(x)) {                                                             \
+        fprintf(stderr, "%s:%i: check failed: %s\n", __FILE__, __LINE__, #x); \
+        exit(1);                                                            \
+    }
+
+enum { NUM_MANY = 5 };
+
+static uint64_t _realtimeUsec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return ((uint64_t)ts.tv_sec) * 1000000ul + ts.tv_nsec / 1000;
+}
+
+static int _waitReadable(int fd)
+{
+    struct pollfd pfd;
+    pfd.fd = fd;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    return poll(&pfd, 1, 1000);
+}
+
+static CanasCanFrame _makeFrame(uint32_t id, uint8_t seed)
+{
+    CanasCanFrame frm;
+    memset(&frm, 0, sizeof(frm));
+    frm.id = id;
+    frm.dlc = 4;
+    for (int i = 0; i < frm.dlc; i++)
+        frm.data[i] = seed + i;
+    return frm;
+}
+
+static void _checkReceived(const CanasCanFrame* prx, const CanasCanFrame* ptx, uint64_t sent_at)
+{
+    ENFORCE(prx->id == ptx->id);
+    ENFORCE(prx->dlc == ptx->dlc);
+    ENFORCE(memcmp(prx->data, ptx->data, ptx->dlc) == 0);
+    // The kernel stamps the frame with CLOCK_REALTIME upon reception
+    ENFORCE(prx->timestamp_usec >= sent_at);
+    ENFORCE(prx->timestamp_usec <= _realtimeUsec());
+}
+
+int main(int argc, const char* argv[])
+{
+    const char* ifname = (argc > 1) ? argv[1] : "vcan0";
+    const char* ifnames[2] = { ifname, ifname };
+    int fds[2] = { -1, -1 };
+    if (canInit(ifnames, fds, 2) != 0)
+    {
+        printf("%s is not available, test skipped\n", ifname);
+        return 0;
+    }
+    const int tx = fds[0], rx = fds[1];     // Both sockets are on the same interface, so one hears the other
+
+    // Single frame:
+    const CanasCanFrame single = _makeFrame(0x123, 10);
+    uint64_t sent_at = _realtimeUsec();
+    ENFORCE(canSend(tx, &single) == 1);
+    ENFORCE(_waitReadable(rx) == 1);
+    CanasCanFrame rx_frames[8];
+    ENFORCE(canReceive(rx, rx_frames) == 1);
+    _checkReceived(rx_frames, &single, sent_at);
+
+    // Many frames, extended IDs:
+    CanasCanFrame many[NUM_MANY];
+    for (int i = 0; i < NUM_MANY; i++)
+        many[i] = _makeFrame((0x10000 + i) | CANAS_CAN_FLAG_EFF, 20 + i);
+    sent_at = _realtimeUsec();
+    ENFORCE(canSendMany(tx, many, NUM_MANY) == NUM_MANY);
+    int received = 0;
+    while (received < NUM_MANY)
+    {
+        ENFORCE(_waitReadable(rx) == 1);
+        const int res = canReceiveMany(rx, rx_frames + received, 8 - received);
+        ENFORCE(res >= 0);
+        received += res;
+    }
+    ENFORCE(received == NUM_MANY);
+    for (int i = 0; i < NUM_MANY; i++)
+    {
+        _checkReceived(rx_frames + i, many + i, sent_at);
+        if (i > 0)
+            ENFORCE(rx_frames[i].timestamp_usec >= rx_frames[i - 1].timestamp_usec);
+    }
+
+    // Nothing left:
+    ENFORCE(canReceiveMany(rx, rx_frames, 8) == 0);
+
+    close(tx);
+    close(rx);
+    printf("OK\n");
+    return 0;
+}
@@ -8,7 +8,11 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <errno.h>
+#include <unistd.h>
 #include <sys/time.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
 #include "canaerospace_linux.h"
 
 /**
@@ -40,9 +44,19 @@ static int _drvSend(CanasInstance* pi, int iface, const CanasCanFrame* pframe)
     assert(pi);
     CanasLinux* pcl = (CanasLinux*)pi->pthis;
     assert(iface >= 0);
-    assert(iface < pcl->npollfds);
+    assert(iface < pcl->nsockets);
     assert(pframe);
-    return canSend(pcl->pollfds[iface].fd, pframe);
+    return canSend(pcl->sockets[iface], pframe);
+}
+
+static int _drvSendMany(CanasInstance* pi, int iface, const CanasCanFrame* pframes, int nframes)
+{
+    assert(pi);
+    CanasLinux* pcl = (CanasLinux*)pi->pthis;
+    assert(iface >= 0);
+    assert(iface < pcl->nsockets);
+    assert(pframes);
+    return canSendMany(pcl->sockets[iface], pframes, nframes);
 }
 
 static int _drvFilter(CanasInstance* pi, int iface, const CanasCanFilterConfig* pfilters, int nfilters)
@@ -50,42 +64,110 @@ static int _drvFilter(CanasInstance* pi, int iface, const CanasCanFilterConfig*
     assert(pi);
     CanasLinux* pcl = (CanasLinux*)pi->pthis;
     assert(iface >= 0);
-    assert(iface < pcl->npollfds);
+    assert(iface < pcl->nsockets);
     assert(pfilters);
     assert(nfilters > 0);
-    return canFilterSetup(pcl->pollfds[iface].fd, pfilters, nfilters);
+    return canFilterSetup(pcl->sockets[iface], pfilters, nfilters);
+}
+
+static uint64_t _timestampMicros(CanasInstance* pi)
+{
+    (void)pi;
+    struct timeval tv;
+    assert(gettimeofday(&tv, NULL) == 0);
+    return ((uint64_t)tv.tv_sec) * 1000000ul + tv.tv_usec;
+}
+
+/**
+ * Max number of frames passed to the library at once.
+ */
+#define RX_BATCH_LEN 64
+
+/**
+ * Epoll data of the timer; sockets are identified by the interface index.
+ */
+#define TIMER_EVENT_ID 0xFFFFFFFFu
+
+static int _armTimer(int timer_fd, uint64_t deadline_usec)
+{
+    struct itimerspec its;
+    memset(&its, 0, sizeof(its));
+    if (deadline_usec == CANAS_DEADLINE_NONE)
+        return timerfd_settime(timer_fd, 0, &its, NULL);   // Nothing to wait for, disarm
+    its.it_value.tv_sec  = deadline_usec / 1000000ul;
+    its.it_value.tv_nsec = (deadline_usec % 1000000ul) * 1000ul;
+    if (its.it_value.tv_sec == 0 && its.it_value.tv_nsec == 0)
+        its.it_value.tv_nsec = 1;           // Zero would disarm the timer, but this deadline is already due
+    return timerfd_settime(timer_fd, TFD_TIMER_ABSTIME, &its, NULL);
 }
 
 /**
  * This function is not provided by SocketCAN driver because your application may need to
  * perform more complex IO multiplexing with other sockets.
+ * Every ready socket gives at most one batch per call; the sockets that still have frames are reported by the
+ * next epoll_wait() again, so a busy interface can't starve the others.
+ * Returns negative on IO failure; the library's verdict is stored separately.
  */
-static int _receive(CanasInstance* pi, int* piface, CanasCanFrame* pframe, int timeout_ms)
+static int _receiveAndUpdate(CanasInstance* pi, int timeout_ms, int* pupdate_res)
 {
     CanasLinux* pcl = (CanasLinux*)pi->pthis;
-    const int ret = poll(pcl->pollfds, pcl->npollfds, timeout_ms);
-    if (ret <= 0)
-        return ret;
-    *piface = -1;
-    for (int i = 0; i < pcl->npollfds; i++)
+
+    uint64_t deadline = canasGetNextDeadline(pi);
+    if (timeout_ms >= 0)
+    {
+        const uint64_t app_deadline = _timestampMicros(pi) + timeout_ms * 1000ull;
+        deadline = (app_deadline < deadline) ? app_deadline : deadline;
+    }
+    if (_armTimer(pcl->timer_fd, deadline) < 0)
+        return -1;
+
+    struct epoll_event events[CANAS_IFACE_COUNT_MAX + 1];
+    const int nevents = epoll_wait(pcl->epoll_fd, events, CANAS_IFACE_COUNT_MAX + 1, -1);
+    if (nevents < 0)
+        return (errno == EINTR) ? 0 : -1;
+
+    bool ready[CANAS_IFACE_COUNT_MAX];
+    memset(ready, 0, sizeof(ready));
+    bool any_ready = false;
+    for (int i = 0; i < nevents; i++)
     {
-        if (pcl->pollfds[i].revents & POLLIN)
+        if (events[i].data.u32 == TIMER_EVENT_ID)
         {
-            *piface = i;
-            break;
+            uint64_t expirations = 0;
+            (void)read(pcl->timer_fd, &expirations, sizeof(expirations));
+        }
+        else
+        {
+            ready[events[i].data.u32] = true;
+            any_ready = true;
         }
     }
-    if (*piface < 0)
+    if (!any_ready)
+    {
+        *pupdate_res = canasUpdate(pi, -1, NULL);   // Timeout, we need to update lib's state anyway
         return 0;
-    return canReceive(pcl->pollfds[*piface].fd, pframe);
-}
+    }
 
-static uint64_t _timestampMicros(CanasInstance* pi)
-{
-    (void)pi;
-    struct timeval tv;
-    assert(gettimeofday(&tv, NULL) == 0);
-    return ((uint64_t)tv.tv_sec) * 1000000ul + tv.tv_usec;
+    CanasCanFrame frames[RX_BATCH_LEN];
+    uint8_t ifaces[RX_BATCH_LEN];
+    int first_error = 0;
+    int io_error = 0;
+    for (int i = 0; i < pcl->nsockets; i++)
+    {
+        if (!ready[i])
+            continue;
+        const int res = canReceiveMany(pcl->sockets[i], frames, RX_BATCH_LEN);
+        if (res < 0)
+        {
+            io_error = res;
+            break;
+        }
+        memset(ifaces, i, res);
+        const int update_res = canasUpdateBatch(pi, frames, ifaces, res);
+        first_error = first_error ? first_error : update_res;
+    }
+    *pupdate_res = first_error;
+    return io_error;
 }
 
 int canasLinuxInit(CanasInstance* pi, const char* pifaces[], int nifaces,
@@ -99,6 +181,7 @@ int canasLinuxInit(CanasInstance* pi, const char* pifaces[], int nifaces,
     cfg.fn_malloc = _cbMalloc;
     cfg.fn_free   = _cbFree;      // Optional (see manual)
     cfg.fn_send   = _drvSend;
+    cfg.fn_send_many = _drvSendMany; // Optional, saves system calls
     cfg.fn_filter = _drvFilter;
     cfg.fn_hook   = NULL;        // Optional
     cfg.fn_timestamp = _timestampMicros;
@@ -119,7 +202,7 @@ int canasLinuxInit(CanasInstance* pi, const char* pifaces[], int nifaces,
     }
 
     // Initialize auxiliary structure with platform-specific data:
-    const int clsize = sizeof(CanasLinux) + sizeof(struct pollfd) * nifaces;
+    const int clsize = sizeof(CanasLinux) + sizeof(int) * nifaces;
     CanasLinux* pcl = malloc(clsize);
     if (pcl == NULL)
     {
@@ -127,11 +210,29 @@ int canasLinuxInit(CanasInstance* pi, const char* pifaces[], int nifaces,
         return -1;
     }
     memset(pcl, 0, clsize);
-    pcl->npollfds = nifaces;
+    pcl->nsockets = nifaces;
     for (int i = 0; i < nifaces; i++)
+        pcl->sockets[i] = psockets[i];
+
+    // All sockets and the deadline timer are waited upon at once:
+    pcl->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    pcl->timer_fd = timerfd_create(CLOCK_REALTIME, TFD_NONBLOCK | TFD_CLOEXEC);  // Same clock as gettimeofday()
+    if (pcl->epoll_fd < 0 || pcl->timer_fd < 0)
     {
-        pcl->pollfds[i].fd = psockets[i];
-        pcl->pollfds[i].events = POLLIN;
+        perror("Failed to create the event loop");
+        return -1;
+    }
+    for (int i = 0; i <= nifaces; i++)
+    {
+        struct epoll_event ev;
+        memset(&ev, 0, sizeof(ev));
+        ev.events = EPOLLIN;
+        ev.data.u32 = (i < nifaces) ? (uint32_t)i : TIMER_EVENT_ID;
+        if (epoll_ctl(pcl->epoll_fd, EPOLL_CTL_ADD, (i < nifaces) ? psockets[i] : pcl->timer_fd, &ev) != 0)
+        {
+            perror("Failed to set up the event loop");
+            return -1;
+        }
     }
 
     // Initialize the instance of CANaerospace:
@@ -145,22 +246,13 @@ int canasLinuxInit(CanasInstance* pi, const char* pifaces[], int nifaces,
 
 int canasLinuxSpinOnce(CanasInstance* pi, int timeout_ms)
 {
-    CanasCanFrame frame;
-    int iface = -1;
-
-    // Read the next incoming frame from any of the available interfaces:
-    int res = _receive(pi, &iface, &frame, timeout_ms);
+    int update_res = 0;
+    const int res = _receiveAndUpdate(pi, timeout_ms, &update_res);
     if (res < 0)
         return res;
 
-    // In case of timeout we need to update lib's state by calling canasUpdate() with pframe=NULL
-    if (res)
-        res = canasUpdate(pi, iface, &frame);
-    else
-        res = canasUpdate(pi, -1, NULL);
-
     // Temporary failure is possible if malformed frame received
-    if (res)
-        printf("CANaerospace update error: %i\n", res);
+    if (update_res)
+        printf("CANaerospace update error: %i\n", update_res);
     return 0;
 }
@@ -6,7 +6,6 @@
 #ifndef CANAEROSPACE_LINUX_H_
 #define CANAEROSPACE_LINUX_H_
 
-#include <poll.h>
 #include <canaerospace/canaerospace.h>
 #include <canaerospace_drivers/socketcan/socketcan.h>
 
@@ -21,8 +20,10 @@ typedef struct
 {
     void* pappdata;
     char dump_buf[CANAS_DUMP_BUF_LEN];
-    int npollfds;
-    struct pollfd pollfds[];
+    int epoll_fd;
+    int timer_fd;               ///< Armed to the nearest deadline before every wait
+    int nsockets;
+    int sockets[];
 } CanasLinux;
 
 /**
@@ -32,7 +33,10 @@ int canasLinuxInit(CanasInstance* pi, const char* pifaces[], int nifaces,
                    int node_id, int redund_chan_id, int service_chan);
 
 /**
- * Interval between subsequent calls should not be higher than 10ms.
+ * Waits for incoming frames or for the library's next deadline, whichever comes first, and processes them.
+ * There is no need to call it periodically; the library will be updated exactly when it needs to.
+ * @param [in] timeout_ms Max time to wait for the application's own needs, or negative to wait indefinitely.
+ * @return 0 on success, negative on IO failure.
  */
 int canasLinuxSpinOnce(CanasInstance* pi, int timeout_ms);
 
@@ -13,7 +13,6 @@
 #include <canaerospace/param_id/nod_default.h>
 #include <canaerospace/services/std_identification.h>
 
-static const int SPIN_TIMEOUT_MS = 10;
 static const int PUB_INTERVAL_MS = 5000;
 static const int IDS_QUERY_INTERVAL_MS = 30000;
 
@@ -34,6 +33,16 @@ static uint64_t _timestampMicros(void)
     return ((uint64_t)tv.tv_sec) * 1000000ul + tv.tv_usec;
 }
 
+/**
+ * Milliseconds until the periodic task is due, zero if it is overdue
+ */
+static int _msUntil(uint64_t last_run_usec, int interval_ms)
+{
+    const uint64_t elapsed = _timestampMicros() - last_run_usec;
+    const uint64_t interval = interval_ms * 1000ull;
+    return (elapsed >= interval) ? 0 : (int)((interval - elapsed + 999) / 1000);
+}
+
 /**
  * This callback will be called when new parameter message arrives.
  * Note that each parameter may have a dedicated callback as well as share it with other parameters.
@@ -60,6 +69,7 @@ static void _pollParams(CanasInstance* pi)
      * Nothing special, just call canasParamPublish()
      */
     CanasMessageData msgd;
+    canasTxBegin(pi);                   // Both publications will be sent at once, see canasTxBegin()
     msgd.type = CANAS_DATATYPE_CHAR4;   // This is standard type for this parameter
     msgd.container.CHAR4[0] = ptm->tm_hour;
     msgd.container.CHAR4[1] = ptm->tm_min;
@@ -79,6 +89,8 @@ static void _pollParams(CanasInstance* pi)
     assert(0 == canasParamAdvertise(pi, CANAS_NOD_DEF_DATE, false));
     assert(0 == canasParamPublish(pi, CANAS_NOD_DEF_DATE, &msgd, 0));
     assert(0 == canasParamUnadvertise(pi, CANAS_NOD_DEF_DATE));
+    if (canasTxEnd(pi) != 0)
+        printf("Failed to send the parameters\n");
 
     // Collect the values of the subscribed parameter without callbacks:
     int redund_chan = 0;
@@ -151,16 +163,19 @@ int main(int argc, const char* argv[])
     uint64_t last_ids_query = _timestampMicros();
     for (;;)
     {
-        res = canasLinuxSpinOnce(&inst, SPIN_TIMEOUT_MS);
+        // Sleep until something happens on the bus, the library needs an update, or one of our tasks is due:
+        const int pub_ms = _msUntil(last_param_polling, PUB_INTERVAL_MS);
+        const int ids_ms = _msUntil(last_ids_query, IDS_QUERY_INTERVAL_MS);
+        res = canasLinuxSpinOnce(&inst, (pub_ms < ids_ms) ? pub_ms : ids_ms);
         assert(res == 0);
 
-        if (_timestampMicros() - last_param_polling > (unsigned int)(PUB_INTERVAL_MS * 1000))
+        if (_msUntil(last_param_polling, PUB_INTERVAL_MS) == 0)
         {
             last_param_polling = _timestampMicros();
             _pollParams(&inst);
         }
 
-        if (_timestampMicros() - last_ids_query > (unsigned int)(IDS_QUERY_INTERVAL_MS * 1000))
+        if (_msUntil(last_ids_query, IDS_QUERY_INTERVAL_MS) == 0)
         {
             last_ids_query = _timestampMicros();
             _performIdsQuery(&inst);
@@ -22,18 +22,35 @@ static const int MY_SOFTWARE_REVISION = 0xad;
 static CanasInstance _canas_instance;
 static MUTEX_DECL(_canas_mutex);
 
+/**
+ * Time until the library needs to be updated, see canasGetNextDeadline().
+ * It is limited because the main thread may initiate new IDS requests while the reader is blocked.
+ */
+static unsigned int getUpdateTimeoutUsec(void)
+{
+    static const uint64_t MAX_TIMEOUT_USEC = 100 * 1000;
+    chMtxLock(&_canas_mutex);
+    const uint64_t deadline = canasGetNextDeadline(&_canas_instance);
+    chMtxUnlock();
+
+    const uint64_t timestamp = sysTimestampMicros();
+    if (deadline <= timestamp)
+        return 0;
+    return (deadline - timestamp < MAX_TIMEOUT_USEC) ? (unsigned int)(deadline - timestamp) : MAX_TIMEOUT_USEC;
+}
+
 static WORKING_AREA(waReader, 2048);
 static msg_t readerThread(void* arg)
 {
     (void)arg;
-    static const int UPDATE_INTERVAL_USEC = 10 * 1000;
 
     chRegSetThreadName("canrx");
     while (1)
     {
         CanasCanFrame frm;
         int iface = -1;
-        int ret = canReceive(&iface, &frm, UPDATE_INTERVAL_USEC);
+        // Sleeps on the RX event until a frame arrives or the library needs to be updated:
+        int ret = canReceive(&iface, &frm, getUpdateTimeoutUsec());
         if (ret < 0)
         {
             printf("CAN RX failed: %i\n", ret);
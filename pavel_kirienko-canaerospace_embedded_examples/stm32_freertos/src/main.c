@@ -13,6 +13,7 @@
 #include <semphr.h>
 #include <can_driver.h>
 #include <canaerospace/canaerospace.h>
+#include <canaerospace/pool.h>
 #include <canaerospace/param_id/nod_default.h>
 #include <canaerospace/services/std_identification.h>
 #include "srvport/srvport.h"
@@ -27,46 +28,23 @@ static const int MY_SERVICE_CHAN = 8;
 static const int MY_HARDWARE_REVISION = 0xab;
 static const int MY_SOFTWARE_REVISION = 0xcd;
 
-#define STATIC_MALLOC_POOL_SIZE  1024
+#define MEMORY_POOL_SIZE  3072      ///< Also holds the index pages, see CANAEROSPACE_COMPACT_INDEX
 
 /**
  * Platform-specific data
  */
 typedef struct
 {
-    uint8_t malloc_pool[STATIC_MALLOC_POOL_SIZE] __attribute__((aligned(__BIGGEST_ALIGNMENT__)));
+    uint8_t pool_buf[MEMORY_POOL_SIZE];
+    CanasPool pool;                     ///< Blocks are freed on unsubscription, so the memory is reused
     char dump_buf[CANAS_DUMP_BUF_LEN];
-    int malloc_offset;
+    uint32_t reported_pool_failures;
     xSemaphoreHandle rmutex;
 } CanasPlatform;
 
 static CanasPlatform _canas_platform;
 static CanasInstance _canas_instance;
 
-static void* _staticMalloc(CanasInstance* pi, int size)
-{
-    ASSERT(pi);
-    ASSERT(size > 0);
-    CanasPlatform* ppl = (CanasPlatform*)pi->pthis;
-    ASSERT(ppl);
-
-    // Proper alignment is absolutely vital:
-    ASSERT(((size_t)ppl->malloc_pool) % __BIGGEST_ALIGNMENT__ == 0);
-    if (size % __BIGGEST_ALIGNMENT__ != 0)
-        size += __BIGGEST_ALIGNMENT__ - size % __BIGGEST_ALIGNMENT__;
-
-    if (size >= STATIC_MALLOC_POOL_SIZE - ppl->malloc_offset)
-    {
-        srvportPrint("Not enough memory in pool\n");
-        return NULL;
-    }
-    void* ptr = ppl->malloc_pool + ppl->malloc_offset;
-    ppl->malloc_offset += size;
-    reentPrintf("Static malloc: %i requested, %i in use, %i left\n",
-                size, ppl->malloc_offset, STATIC_MALLOC_POOL_SIZE - ppl->malloc_offset);
-    return ptr;
-}
-
 static uint64_t _getTimestamp(CanasInstance* pi)
 {
     (void)pi;
@@ -86,11 +64,32 @@ static void _paramCallback(CanasInstance* pi, CanasParamCallbackArgs* pargs)
         canasDumpMessage(&pargs->message, _canas_platform.dump_buf));
 }
 
+/**
+ * Time until the library needs to be updated, see canasGetNextDeadline().
+ * It is limited because the other tasks may initiate new service requests while the spinner is blocked.
+ */
+static unsigned int _getUpdateTimeoutUsec(void)
+{
+    static const uint64_t MAX_TIMEOUT_USEC = 100 * 1000;
+    uint64_t deadline = CANAS_DEADLINE_NONE;
+    if (xSemaphoreTakeRecursive(_canas_platform.rmutex, portMAX_DELAY))
+    {
+        deadline = canasGetNextDeadline(&_canas_instance);
+        xSemaphoreGiveRecursive(_canas_platform.rmutex);
+    }
+    else
+        srvportPrint("Failed to lock the mutex\n");
+
+    const uint64_t timestamp = sysTimestampMicros();
+    if (deadline <= timestamp)
+        return 0;
+    return (deadline - timestamp < MAX_TIMEOUT_USEC) ? (unsigned int)(deadline - timestamp) : MAX_TIMEOUT_USEC;
+}
+
 static void _taskSpin(void* parg)
 {
     (void)parg;
     srvportPrint("Spinner started\n");
-    static const int UPDATE_INTERVAL_USEC = 10 * 1000;
     while (1)
     {
         CanasCanFrame frm;
@@ -98,8 +97,9 @@ static void _taskSpin(void* parg)
         /*
          * Note that CAN driver is fully reentrant, and it is possible to perform
          * blocking canReceive() and canSend() (or whatever) at the same time.
+         * The RX queue is read with the timeout, so the task sleeps until a frame arrives or the library needs it.
          */
-        int ret = canReceive(&iface, &frm, UPDATE_INTERVAL_USEC);
+        int ret = canReceive(&iface, &frm, _getUpdateTimeoutUsec());
         if (ret < 0)
         {
             reentPrintf("Reception failed: %i\n", ret);
@@ -189,6 +189,15 @@ static void _taskMonitor(void* parg)
                     reentPrintf("CAN%i errmask %04x\n", i, errmask);
                 }
             }
+            // The pool is accessed by the library only, so it is protected by the same mutex:
+            const CanasPool* ppool = &_canas_platform.pool;
+            if (ppool->failures != _canas_platform.reported_pool_failures)
+            {
+                _canas_platform.reported_pool_failures = ppool->failures;
+                reentPrintf("Out of memory: %u failures, %u of %u bytes used at peak\n", (unsigned)ppool->failures,
+                            (unsigned)ppool->bytes_peak, (unsigned)ppool->buf_size);
+                have_errors = true;
+            }
             sysLedSet(have_errors);
             xSemaphoreGiveRecursive(_canas_platform.rmutex);
         }
@@ -227,7 +236,9 @@ static void _init(void)
     cfg.iface_count = CAN_IFACE_COUNT;
     cfg.fn_send     = _drvSend;
     cfg.fn_filter   = _drvFilter;
-    cfg.fn_malloc   = _staticMalloc;        // No dynamic memory needed. Thus, free() is not necessary too.
+    cfg.fn_malloc   = canasPoolMallocFn;    // Static pool instead of the heap
+    cfg.fn_free     = canasPoolFreeFn;
+    cfg.pmem_state  = &_canas_platform.pool;
     cfg.fn_timestamp = _getTimestamp;
     // Each function pointer is initialized to NULL, so no need to assign them by hand.
     // These settings are application-defined:
@@ -236,6 +247,7 @@ static void _init(void)
     cfg.service_channel   = MY_SERVICE_CHAN;
 
     memset(&_canas_platform, 0, sizeof(_canas_platform));
+    ASSERT_ALWAYS(0 == canasPoolInit(&_canas_platform.pool, _canas_platform.pool_buf, MEMORY_POOL_SIZE));
     _canas_platform.rmutex = xSemaphoreCreateRecursiveMutex();
     ASSERT_ALWAYS(_canas_platform.rmutex != NULL);
 